@@ -16,8 +16,10 @@
 #include "Type/PieceColor.h"
 #include "Type/PinBitBoard.h"
 #include "Type/CheckBitBoard.h"
+#include "Type/AttackContext.h"
 #include "Type/PreviousState.h"
 #include "Type/Zobrist.h"
+#include "Type/Move.h"
 
 #include "Template/MoveType.h"
 
@@ -36,6 +38,29 @@ namespace StockDory
     {
 
         private:
+#ifdef STOCKDORY_COMPACT_BOARD
+            // Compact layout: the first cache line holds the six piece and two color bitboards, the second one the
+            // mailbox (a nibble per square) and the state, so copying the board or taking a move back touches at
+            // most two cache lines. A piece board is the intersection of its piece and color bitboards.
+            alignas(64) std::array<BitBoard, 6> PieceBB {};
+
+            std::array<BitBoard, 2> ColorBB {};
+
+            // [ SQUARE 2N + 1 ] [  SQUARE 2N  ]
+            // [    4 BITS     ] [   4 BITS    ]
+            // Each nibble is [COLOR] [PIECE] with a 1 bit color and a 3 bit piece, an empty square holds NAP.
+            std::array<uint8_t, 32> Mailbox {};
+
+            ZobristHash Hash = 0;
+
+            // [COLOR TO MOVE] [WHITE KING CASTLE] [WHITE QUEEN CASTLE] [BLACK KING CASTLE] [BLACK QUEEN CASTLE]
+            // [    4 BITS   ] [      1 BIT      ] [       1 BIT      ] [      1 BIT      ] [       1 BIT      ]
+            uint8_t CastlingRightAndColorToMove = 0;
+
+            Square EnPassantSq = NASQ;
+
+            constexpr static uint8_t EmptyNibble = NAP;
+#else
             std::array<std::array<BitBoard, 7>, 3> BB {};
 
             std::array<PieceColor, 64> PieceAndColor {};
@@ -49,6 +74,7 @@ namespace StockDory
             BitBoard EnPassantTarget = BBDefault;
 
             ZobristHash Hash = 0;
+#endif
 
             constexpr static uint8_t     CastlingMask = 0x0F;
             constexpr static uint8_t WhiteKCastleMask = 0x08;
@@ -73,6 +99,8 @@ namespace StockDory
                 {Square::F8, Square::D8}
             }};
 
+            constexpr static std::array<int, 7> SEEValue { 100, 310, 320, 500, 900, 20000, 0 };
+
             // ----- New Castling Performed Flags -----
             bool hasWhiteCastledKingside = false;
             bool hasWhiteCastledQueenside = false;
@@ -92,11 +120,7 @@ namespace StockDory
             // ----- New SetFEN Method -----
             void SetFEN(const std::string& fen)
             {
-                PieceColor none = PieceColor(NAP, NAC);
-                std::fill(std::begin(PieceAndColor), std::end(PieceAndColor), none);
-
-                for (uint8_t i = 0; i < 3; i++)
-                    std::fill(std::begin(BB[i]), std::end(BB[i]), BBDefault);
+                Clear();
 
                 std::vector<std::string> splitFen = strutil::split(fen, " ");
 
@@ -110,12 +134,6 @@ namespace StockDory
                 }
                 std::reverse(splitPosition.begin(), splitPosition.end());
 
-                // Reset Castling Performed Flags
-                hasWhiteCastledKingside = false;
-                hasWhiteCastledQueenside = false;
-                hasBlackCastledKingside = false;
-                hasBlackCastledQueenside = false;
-
                 for (uint8_t v = 0; v < 8; v++) {
                     std::string& rankStr = splitPosition[v];
                     uint8_t h = 0;
@@ -156,10 +174,8 @@ namespace StockDory
                             throw std::out_of_range("Invalid FEN string: File exceeds 'h'.");
                         }
 
-                        uint8_t idx = v * 8 + h;
-                        auto sq = static_cast<Square>(idx);
-                        Set<true>(BB[color][piece], sq);
-                        PieceAndColor[idx] = PieceColor(piece, color);
+                        auto sq = static_cast<Square>(v * 8 + h);
+                        InsertNative<ZOBRIST>(piece, color, sq);
                         Hash = HashPiece<ZOBRIST>(Hash, piece, color, sq);
 
                         h++;
@@ -192,13 +208,13 @@ namespace StockDory
                 Hash = HashCastling<ZOBRIST>(Hash, CastlingRightAndColorToMove & CastlingMask);
 
                 // Set En Passant Target
-                EnPassantTarget = BBDefault;
+                SetEnPassant(NASQ);
                 std::string& epData = splitFen[3];
                 if (epData.length() == 2) {
                     Square epSq = Util::StringToSquare(epData);
 
-                    if (AttackTable::Pawn[Opposite(ColorToMove())][epSq] & BB[ColorToMove()][Pawn]) {
-                        EnPassantTarget = FromSquare(epSq);
+                    if (AttackTable::Pawn[Opposite(ColorToMove())][epSq] & PieceBoard(Pawn, ColorToMove())) {
+                        SetEnPassant(epSq);
                         Hash = HashEnPassant<ZOBRIST>(Hash, epSq);
                     } else {
                         throw std::invalid_argument("Invalid En Passant target in FEN.");
@@ -207,15 +223,6 @@ namespace StockDory
                     throw std::invalid_argument("Invalid En Passant field in FEN.");
                 }
 
-                // Update Color Bitboards
-                ColorBB[Color::White] = BBDefault;
-                ColorBB[Color::Black] = BBDefault;
-                for (Piece p = Pawn; p != NAP; p = Next(p)) {
-                    ColorBB[White] |= BB[White][p];
-                    ColorBB[Black] |= BB[Black][p];
-                }
-                ColorBB[NAC] = ~(ColorBB[White] | ColorBB[Black]);
-
                 // Optional: You can parse halfmove clock and fullmove number if needed
                 // For simplicity, they are set to '0' and '1' respectively in the Fen() method
             }
@@ -238,7 +245,7 @@ namespace StockDory
                     std::stringstream rankStr;
                     uint8_t e = 0;
                     for (uint8_t h = 0; h < 8; h++) {
-                        const PieceColor pc = PieceAndColor[v * 8 + h];
+                        const PieceColor pc = PieceAt(v * 8 + h);
 
                         if (pc.Piece() == NAP) {
                             e++;
@@ -306,7 +313,7 @@ namespace StockDory
                 } else fen << '-';
 
                 fen << ' ';
-                if (EnPassantSquare() != NASQ) fen << Util::SquareToString(ToSquare(EnPassantTarget));
+                if (EnPassantSquare() != NASQ) fen << Util::SquareToString(EnPassantSquare());
                 else                           fen << '-';
 
                 // Implement half and full move clocks.
@@ -326,12 +333,12 @@ namespace StockDory
 
             constexpr inline PieceColor operator [](const Square sq) const
             {
-                return PieceAndColor[sq];
+                return PieceAt(sq);
             }
 
             constexpr inline BitBoard operator [](const Color c) const
             {
-                return ColorBB[c];
+                return ColorBoard(c);
             }
 
             template<Color Color>
@@ -341,7 +348,11 @@ namespace StockDory
                 assert(p     != NAP);
                 assert(Color != NAC);
 
+#ifdef STOCKDORY_COMPACT_BOARD
+                return PieceBB[p] & ColorBB[Color];
+#else
                 return BB[Color][p];
+#endif
             }
 
             [[nodiscard]]
@@ -350,7 +361,11 @@ namespace StockDory
                 assert(p != NAP);
                 assert(c != NAC);
 
+#ifdef STOCKDORY_COMPACT_BOARD
+                return PieceBB[p] & ColorBB[c];
+#else
                 return BB[c][p];
+#endif
             }
 
             [[nodiscard]]
@@ -382,13 +397,21 @@ namespace StockDory
             [[nodiscard]]
             constexpr inline BitBoard EnPassant() const
             {
+#ifdef STOCKDORY_COMPACT_BOARD
+                return EnPassantSq == NASQ ? BBDefault : FromSquare(EnPassantSq);
+#else
                 return EnPassantTarget;
+#endif
             }
 
             [[nodiscard]]
             constexpr inline Square EnPassantSquare() const
             {
+#ifdef STOCKDORY_COMPACT_BOARD
+                return EnPassantSq;
+#else
                 return ToSquare(EnPassantTarget);
+#endif
             }
 
             template<Color We>
@@ -397,22 +420,22 @@ namespace StockDory
             {
                 constexpr Color by = Opposite(We);
 
-                const Square king = ToSquare(BB[We][King]);
+                const Square king = ToSquare(PieceBoard(King, We));
 
-                if (AttackTable::Pawn[We][king] & BB[by][Pawn]) return true;
+                if (AttackTable::Pawn[We][king] & PieceBoard(Pawn, by)) return true;
 
-                if (AttackTable::Knight[king] & BB[by][Knight]) return true;
+                if (AttackTable::Knight[king] & PieceBoard(Knight, by)) return true;
 
-                const BitBoard occupied = ~ColorBB[NAC];
-                const BitBoard queen    = BB[by][Queen];
+                const BitBoard occupied = Occupied();
+                const BitBoard queen    = PieceBoard(Queen, by);
 
-                if (AttackTable::Sliding[BlackMagicFactory::MagicIndex(Bishop, king, occupied)] &
-                    (queen | BB[by][Bishop])) return true;
+                if (AttackTable::Sliding[AttackTable::SlidingIndex(Bishop, king, occupied)] &
+                    (queen | PieceBoard(Bishop, by))) return true;
 
-                if (AttackTable::Sliding[BlackMagicFactory::MagicIndex(Rook  , king, occupied)] &
-                    (queen | BB[by][Rook  ])) return true;
+                if (AttackTable::Sliding[AttackTable::SlidingIndex(Rook  , king, occupied)] &
+                    (queen | PieceBoard(Rook  , by))) return true;
 
-                return AttackTable::King[king] & BB[by][King];
+                return AttackTable::King[king] & PieceBoard(King, by);
             }
 
             template<Color By>
@@ -422,11 +445,11 @@ namespace StockDory
                 uint8_t       count = 0;
                 CheckBitBoard check = CheckBitBoard();
 
-                const Square sq = ToSquare(BB[Opposite(By)][King]);
+                const Square sq = ToSquare(PieceBoard(King, Opposite(By)));
 
                 // Check if the square is under attack by opponent knights or pawns.
-                const BitBoard pawnCheck   = AttackTable::Pawn[Opposite(By)][sq] & BB[By][Pawn  ];
-                const BitBoard knightCheck = AttackTable::Knight               [sq] & BB[By][Knight];
+                const BitBoard pawnCheck   = AttackTable::Pawn[Opposite(By)][sq] & PieceBoard(Pawn  , By);
+                const BitBoard knightCheck = AttackTable::Knight               [sq] & PieceBoard(Knight, By);
 
                 // If the square is under attack by a pawn or knight, add it our checks.
                 check.Check |= pawnCheck;
@@ -438,20 +461,20 @@ namespace StockDory
 
                 // Check if the square is under attack by opponent bishops, rooks, or queens.
                 // For queen, we can merge with checks for bishop and rook.
-                const BitBoard queen = BB[By][Queen];
+                const BitBoard queen = PieceBoard(Queen, By);
 
                 // All the occupied squares:
-                BitBoard occupied = ~ColorBB[NAC];
+                BitBoard occupied = Occupied();
 
                 // Check if the square is under attack by opponent bishops or queens (diagonally).
                 const BitBoard diagonalCheck =
-                        AttackTable::Sliding[BlackMagicFactory::MagicIndex(Bishop, sq, occupied)] &
-                        (queen | BB[By][Bishop]);
+                        AttackTable::Sliding[AttackTable::SlidingIndex(Bishop, sq, occupied)] &
+                        (queen | PieceBoard(Bishop, By));
 
                 // Check if the square is under attack by opponent rooks or queens (straight).
                 const BitBoard straightCheck =
-                        AttackTable::Sliding[BlackMagicFactory::MagicIndex(Rook  , sq, occupied)] &
-                        (queen | BB[By][Rook  ]);
+                        AttackTable::Sliding[AttackTable::SlidingIndex(Rook  , sq, occupied)] &
+                        (queen | PieceBoard(Rook  , By));
 
                 // For sliding attacks, we must add the square of the attack's origin and all the squares to us from the
                 // attack:
@@ -484,65 +507,180 @@ namespace StockDory
             {
                 PinBitBoard pin = PinBitBoard();
 
-                const Square sq = ToSquare(BB[We][King]);
+                const Square sq = ToSquare(PieceBoard(King, We));
 
                 // All the occupied squares:
                 // In this case, we want to let the pins pass through our pieces, since our pieces can move on the pins.
-                const BitBoard occupied = ColorBB[By];
+                const BitBoard occupied = ColorBoard(By);
 
                 // For queen, we can merge with checks for bishop and rook.
-                const BitBoard queen = BB[By][Queen];
+                const BitBoard queen = PieceBoard(Queen, By);
 
                 // Check if the square is under attack by opponent bishops or queens (diagonally).
                 const BitBoard diagonalCheck =
-                        AttackTable::Sliding[BlackMagicFactory::MagicIndex(Bishop, sq, occupied)] &
-                        (queen | BB[By][Bishop]);
+                        AttackTable::Sliding[AttackTable::SlidingIndex(Bishop, sq, occupied)] &
+                        (queen | PieceBoard(Bishop, By));
 
                 // Check if the square is under attack by opponent rooks or queens (straight).
                 const BitBoard straightCheck =
-                        AttackTable::Sliding[BlackMagicFactory::MagicIndex(Rook  , sq, occupied)] &
-                        (queen | BB[By][Rook  ]);
+                        AttackTable::Sliding[AttackTable::SlidingIndex(Rook  , sq, occupied)] &
+                        (queen | PieceBoard(Rook  , By));
 
                 // Iterate through the attacks and check if the attack is a diagonally pinning one.
                 BitBoardIterator iterator (diagonalCheck);
                 for (Square attSq = iterator.Value(); attSq != NASQ; attSq = iterator.Value()) {
                     const BitBoard possiblePin = UtilityTable::Between[sq][attSq] | FromSquare(attSq);
-                    if (Count(possiblePin & ColorBB[We]) == 1) pin.Diagonal |= possiblePin;
+                    if (Count(possiblePin & ColorBoard(We)) == 1) pin.Diagonal |= possiblePin;
                 }
 
                 // Iterate through the attacks and check if the attack is a straight pinning one.
                 iterator = BitBoardIterator(straightCheck);
                 for (Square attSq = iterator.Value(); attSq != NASQ; attSq = iterator.Value()) {
                     const BitBoard possiblePin = UtilityTable::Between[sq][attSq] | FromSquare(attSq);
-                    if (Count(possiblePin & ColorBB[We]) == 1) pin.Straight |= possiblePin;
+                    if (Count(possiblePin & ColorBoard(We)) == 1) pin.Straight |= possiblePin;
                 }
 
                 return pin;
             }
 
+            template<Color By>
+            [[nodiscard]]
+            constexpr inline BitBoard Threats() const
+            {
+                // The king under attack is taken off the board, a square behind it on a sliding ray is attacked too.
+                const BitBoard occupied = Occupied() & ~PieceBoard(King, Opposite(By));
+
+                const BitBoard pawn = PieceBoard(Pawn, By);
+                BitBoard threats = By == White ?
+                        (pawn & ~BlackMagicFactory::Horizontal[0]) << 7 | (pawn & ~BlackMagicFactory::Horizontal[7]) << 9 :
+                        (pawn & ~BlackMagicFactory::Horizontal[0]) >> 9 | (pawn & ~BlackMagicFactory::Horizontal[7]) >> 7;
+
+                threats |= AttackTable::King[ToSquare(PieceBoard(King, By))];
+
+                BitBoardIterator iterator (PieceBoard(Knight, By));
+                for (Square sq = iterator.Value(); sq != NASQ; sq = iterator.Value())
+                    threats |= AttackTable::Knight[sq];
+
+                const BitBoard queen = PieceBoard(Queen, By);
+
+                iterator = BitBoardIterator(queen | PieceBoard(Bishop, By));
+                for (Square sq = iterator.Value(); sq != NASQ; sq = iterator.Value())
+                    threats |= AttackTable::Sliding[AttackTable::SlidingIndex(Bishop, sq, occupied)];
+
+                iterator = BitBoardIterator(queen | PieceBoard(Rook  , By));
+                for (Square sq = iterator.Value(); sq != NASQ; sq = iterator.Value())
+                    threats |= AttackTable::Sliding[AttackTable::SlidingIndex(Rook  , sq, occupied)];
+
+                return threats;
+            }
+
+            template<Color We>
+            [[nodiscard]]
+            constexpr inline AttackContext Attacks() const
+            {
+                constexpr Color by = Opposite(We);
+
+                AttackContext context = AttackContext();
+
+                context.King    = ToSquare(PieceBoard(King, We));
+                context.Pin     = Pin<We, by>();
+                context.Threats = Threats<by>();
+
+                // Most nodes are not in check, the attack map already says so without looking at the king's rays.
+                if (!Get(context.Threats, context.King)) {
+                    context.Check.Check = BBFilled;
+                    return context;
+                }
+
+                // In check the mask holds the checkers and the empty squares between them and the king.
+                context.Check    = Check<by>();
+                context.Checkers = context.Check.Check & ColorBoard(by);
+
+                return context;
+            }
+
             [[nodiscard]]
             constexpr inline BitBoard SquareAttackers(const Square sq, const BitBoard occ) const
             {
-                BitBoard attackers = (AttackTable::Pawn  [White][sq] &  BB[Black][Pawn  ]) |
-                                     (AttackTable::Pawn  [Black][sq] &  BB[White][Pawn  ]) |
-                                     (AttackTable::Knight       [sq] & (BB[White][Knight]  | BB[Black][Knight])) |
-                                     (AttackTable::King         [sq] & (BB[White][King  ]  | BB[Black][King  ])) ;
+                BitBoard attackers = (AttackTable::Pawn  [White][sq] &  PieceBoard(Pawn  , Black)) |
+                                     (AttackTable::Pawn  [Black][sq] &  PieceBoard(Pawn  , White)) |
+                                     (AttackTable::Knight       [sq] & (PieceBoard(Knight, White) | PieceBoard(Knight, Black))) |
+                                     (AttackTable::King         [sq] & (PieceBoard(King  , White) | PieceBoard(King  , Black))) ;
 
-                attackers |= AttackTable::Sliding[BlackMagicFactory::MagicIndex(Bishop, sq, occ)] &
-                             (BB[White][Bishop] | BB[Black][Bishop] | BB[White][Queen] | BB[Black][Queen]);
+                attackers |= AttackTable::Sliding[AttackTable::SlidingIndex(Bishop, sq, occ)] &
+                             (PieceBoard(Bishop, White) | PieceBoard(Bishop, Black) | PieceBoard(Queen, White) | PieceBoard(Queen, Black));
 
-                attackers |= AttackTable::Sliding[BlackMagicFactory::MagicIndex(Rook  , sq, occ)] &
-                             (BB[White][Rook  ] | BB[Black][Rook  ] | BB[White][Queen] | BB[Black][Queen]);
+                attackers |= AttackTable::Sliding[AttackTable::SlidingIndex(Rook  , sq, occ)] &
+                             (PieceBoard(Rook  , White) | PieceBoard(Rook  , Black) | PieceBoard(Queen, White) | PieceBoard(Queen, Black));
 
                 return attackers;
             }
 
+            // Static exchange evaluation: does the capture sequence started by the move on its target square win
+            // at least threshold centipawns for the side making it? Both sides always recapture with their least
+            // valuable attacker, and sliders behind a capturing piece are revealed through the magic lookups.
+            [[nodiscard]]
+            constexpr inline bool SEE(const ::Move move, const int threshold) const
+            {
+                const Square from = move.From();
+                const Square to   = move.To  ();
+
+                // Promotions and en passant are treated as even trades.
+                if (move.Promotion() != NAP || (to == EnPassantSquare() &&
+                                                PieceAt(from).Piece() == Pawn))
+                    return threshold <= 0;
+
+                int swap = SEEValue[PieceAt(to).Piece()] - threshold;
+                if (swap < 0) return false;
+
+                swap = SEEValue[PieceAt(from).Piece()] - swap;
+                if (swap <= 0) return true;
+
+                BitBoard occupied  = Occupied() ^ FromSquare(from) ^ FromSquare(to);
+                BitBoard attackers = SquareAttackers(to, occupied);
+
+                const BitBoard diagonal = PieceBoard(Bishop, White) | PieceBoard(Bishop, Black) | PieceBoard(Queen, White) | PieceBoard(Queen, Black);
+                const BitBoard straight = PieceBoard(Rook  , White) | PieceBoard(Rook  , Black) | PieceBoard(Queen, White) | PieceBoard(Queen, Black);
+
+                Color stm    = PieceAt(from).Color();
+                bool  result = true;
+
+                while (true) {
+                    stm = Opposite(stm);
+                    attackers &= occupied;
+
+                    const BitBoard stmAttackers = attackers & ColorBoard(stm);
+                    if (!stmAttackers) break;
+
+                    result = !result;
+
+                    // The king can only recapture if the opponent has nothing left to take back with.
+                    Piece attacker = Pawn;
+                    while (attacker != King && !(stmAttackers & PieceBoard(attacker, stm))) attacker = Next(attacker);
+
+                    if (attacker == King) return (attackers & ColorBoard(Opposite(stm))) ? !result : result;
+
+                    swap = SEEValue[attacker] - swap;
+                    if (swap < result) break;
+
+                    occupied ^= FromSquare(ToSquare(stmAttackers & PieceBoard(attacker, stm)));
+
+                    // X-ray: the piece that just captured may have been screening a slider.
+                    if (attacker == Pawn || attacker == Bishop || attacker == Queen)
+                        attackers |= AttackTable::Sliding[AttackTable::SlidingIndex(Bishop, to, occupied)] & diagonal;
+                    if (attacker == Rook || attacker == Queen)
+                        attackers |= AttackTable::Sliding[AttackTable::SlidingIndex(Rook  , to, occupied)] & straight;
+                }
+
+                return result;
+            }
+
             constexpr inline PreviousStateNull Move()
             {
                 auto state = PreviousStateNull(EnPassantSquare());
 
                 Hash = HashEnPassant<ZOBRIST>(Hash, EnPassantSquare());
-                EnPassantTarget = BBDefault;
+                SetEnPassant(NASQ);
 
                 CastlingRightAndColorToMove ^= ColorFlipMask;
                 Hash = HashColorFlip<ZOBRIST>(Hash);
@@ -553,7 +691,7 @@ namespace StockDory
             constexpr inline void UndoMove(const PreviousStateNull& state)
             {
                 if (state.EnPassant != NASQ) {
-                    EnPassantTarget = FromSquare(state.EnPassant);
+                    SetEnPassant(state.EnPassant);
                     Hash = HashEnPassant<ZOBRIST>(Hash, state.EnPassant);
                 }
 
@@ -566,12 +704,12 @@ namespace StockDory
             {
 
 
-                auto state = PreviousState(PieceAndColor[from], PieceAndColor[to],
+                auto state = PreviousState(PieceAt(from), PieceAt(to),
                                            EnPassantSquare(), CastlingRightAndColorToMove,
                                            Hash);
 
                 Hash = HashEnPassant<T>(Hash, EnPassantSquare());
-                EnPassantTarget = BBDefault;
+                SetEnPassant(NASQ);
 
                 CastlingRightAndColorToMove ^= ColorFlipMask;
                 Hash = HashColorFlip<T>(Hash);
@@ -604,11 +742,11 @@ namespace StockDory
                     } else if (static_cast<Square>(from ^ 16) == to) {
                         const auto epSq = static_cast<Square>(to ^ 8);
                         if (T & PERFT) {
-                            EnPassantTarget = FromSquare(epSq);
+                            SetEnPassant(epSq);
                             Hash = HashEnPassant<T>(Hash, epSq);
                         } else {
-                            if (AttackTable::Pawn[colorF][epSq] & BB[Opposite(colorF)][Pawn]) {
-                                EnPassantTarget = FromSquare(epSq);
+                            if (AttackTable::Pawn[colorF][epSq] & PieceBoard(Pawn, Opposite(colorF))) {
+                                SetEnPassant(epSq);
                                 Hash = HashEnPassant<T>(Hash, epSq);
                             }
                         }
@@ -682,8 +820,7 @@ namespace StockDory
                 CastlingRightAndColorToMove = state.CastlingRightAndColorToMove;
                 if (T & ZOBRIST) Hash = state.Hash;
 
-                if (state.EnPassant != NASQ) EnPassantTarget = FromSquare(state.EnPassant);
-                else                         EnPassantTarget = BBDefault;
+                SetEnPassant(state.EnPassant);
 
                 if (state.PromotedPiece         != NAP) {
                     EmptyNative <T>(state.PromotedPiece, state.MovedPiece.Color(), to  );
@@ -709,54 +846,146 @@ namespace StockDory
                                              const Piece pT, const Color cT, const Square sqT)
             {
                 // Capture Section:
-                Set<false>(BB[cT][pT], sqT);
-
-                Set<false>(ColorBB[cT], sqT);
+                if (pT != NAP) Toggle(pT, cT, FromSquare(sqT));
 
                 // MoveNative Section:
-                Set<false>(BB[cF][pF], sqF);
-                Set<true >(BB[cF][pF], sqT);
-
-                Set<false>(ColorBB[cF], sqF);
-                Set<true >(ColorBB[cF], sqT);
+                Toggle(pF, cF, FromSquare(sqF) | FromSquare(sqT));
 
                 UpdateNACBB();
 
-                PieceAndColor[sqT] = PieceAndColor[sqF];
-                PieceAndColor[sqF] = PieceColor(NAP, NAC);
+                SetPieceAt(sqT, PieceColor(pF , cF ));
+                SetPieceAt(sqF, PieceColor(NAP, NAC));
             }
 
             template<MoveType T>
             constexpr inline void EmptyNative(const Piece p, const Color c, const Square sq)
             {
-                Set<false>(BB[c][p], sq);
+                if (p == NAP) return;
 
-                Set<false>(ColorBB[c], sq);
+                Toggle(p, c, FromSquare(sq));
 
                 UpdateNACBB();
 
-                PieceAndColor[sq] = PieceColor(NAP, NAC);
+                SetPieceAt(sq, PieceColor(NAP, NAC));
             }
 
             template<MoveType T>
             constexpr inline void InsertNative(const Piece p, const Color c, const Square sq)
             {
-                Set<true>(BB[c][p], sq);
-
-                Set<true>(ColorBB[c], sq);
+                Toggle(p, c, FromSquare(sq));
 
                 UpdateNACBB();
 
-                PieceAndColor[sq] = PieceColor(p, c);
+                SetPieceAt(sq, PieceColor(p, c));
+            }
+
+        private:
+            [[nodiscard]]
+            constexpr inline BitBoard ColorBoard(const Color c) const
+            {
+#ifdef STOCKDORY_COMPACT_BOARD
+                return c == NAC ? ~(ColorBB[White] | ColorBB[Black]) : ColorBB[c];
+#else
+                return ColorBB[c];
+#endif
+            }
+
+            [[nodiscard]]
+            constexpr inline BitBoard Occupied() const
+            {
+#ifdef STOCKDORY_COMPACT_BOARD
+                return ColorBB[White] | ColorBB[Black];
+#else
+                return ~ColorBB[NAC];
+#endif
+            }
+
+            [[nodiscard]]
+            constexpr inline PieceColor PieceAt(const uint8_t sq) const
+            {
+#ifdef STOCKDORY_COMPACT_BOARD
+                const uint8_t nibble = Mailbox[sq >> 1] >> ((sq & 1) << 2) & 0x0F;
+                const Piece   piece  = static_cast<Piece>(nibble & 0x07);
+
+                return piece == NAP ? PieceColor(NAP, NAC) : PieceColor(piece, static_cast<Color>(nibble >> 3));
+#else
+                return PieceAndColor[sq];
+#endif
+            }
+
+            constexpr inline void SetPieceAt(const Square sq, const PieceColor pc)
+            {
+#ifdef STOCKDORY_COMPACT_BOARD
+                const uint8_t nibble = pc.Piece() == NAP ? EmptyNibble : pc.Piece() | pc.Color() << 3;
+                const uint8_t shift  = (sq & 1) << 2;
+
+                Mailbox[sq >> 1] = (Mailbox[sq >> 1] & ~(0x0F << shift)) | nibble << shift;
+#else
+                PieceAndColor[sq] = pc;
+#endif
+            }
+
+            // Flips the squares of a piece of a color on and off, they are always all on or all off beforehand.
+            constexpr inline void Toggle(const Piece p, const Color c, const BitBoard squares)
+            {
+#ifdef STOCKDORY_COMPACT_BOARD
+                PieceBB[p] ^= squares;
+#else
+                BB[c][p] ^= squares;
+#endif
+                ColorBB[c] ^= squares;
+            }
+
+            constexpr inline void SetEnPassant(const Square sq)
+            {
+#ifdef STOCKDORY_COMPACT_BOARD
+                EnPassantSq = sq;
+#else
+                EnPassantTarget = sq == NASQ ? BBDefault : FromSquare(sq);
+#endif
             }
 
             constexpr inline void UpdateNACBB()
             {
+#ifndef STOCKDORY_COMPACT_BOARD
                 ColorBB[Color::NAC] = ~(ColorBB[Color::White] | ColorBB[Color::Black]);
+#endif
+            }
+
+            constexpr inline void Clear()
+            {
+#ifdef STOCKDORY_COMPACT_BOARD
+                PieceBB.fill(BBDefault);
+                ColorBB.fill(BBDefault);
+                Mailbox.fill(EmptyNibble | EmptyNibble << 4);
+#else
+                for (uint8_t i = 0; i < 3; i++)
+                    std::fill(std::begin(BB[i]), std::end(BB[i]), BBDefault);
+
+                std::fill(std::begin(PieceAndColor), std::end(PieceAndColor), PieceColor(NAP, NAC));
+
+                ColorBB[White] = BBDefault;
+                ColorBB[Black] = BBDefault;
+#endif
+                UpdateNACBB();
+
+                CastlingRightAndColorToMove = 0;
+                SetEnPassant(NASQ);
+                Hash = 0;
+
+                // Reset Castling Performed Flags
+                hasWhiteCastledKingside  = false;
+                hasWhiteCastledQueenside = false;
+                hasBlackCastledKingside  = false;
+                hasBlackCastledQueenside = false;
             }
 
     };
 
+#ifdef STOCKDORY_COMPACT_BOARD
+    static_assert(sizeof(Board) == 128, "The compact board must fit in two cache lines.");
+#endif
+
 } // StockDory
 
 #endif //STOCKDORY_BOARD_H
\ No newline at end of file
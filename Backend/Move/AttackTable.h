@@ -9,6 +9,7 @@
 #include <array>
 
 #include "BlackMagicFactory.h"
+#include "PextFactory.h"
 
 #include "../Type/BitBoard.h"
 #include "../Type/Piece.h"
@@ -100,14 +101,36 @@ namespace StockDory
                 0x2838000000000000, 0x5070000000000000, 0xA0E0000000000000, 0x40C0000000000000
             };
 
-            static std::array<BitBoard, 87988> Sliding;
+#ifdef STOCKDORY_PEXT
+            constexpr static uint32_t SlidingSize = PextFactory::TableSize;
+#else
+            constexpr static uint32_t SlidingSize = 87988;
+#endif
+
+            // Index into Sliding for a bishop or rook on the square, chosen at compile time: PEXT on BMI2 builds with
+            // STOCKDORY_PEXT (a dense table), black magic (multiply and shift into an overlapping table) otherwise.
+            constexpr static inline uint32_t SlidingIndex(const Piece p, const Square sq, const BitBoard occupied)
+            {
+#ifdef STOCKDORY_PEXT
+                return PextFactory::PextIndex(p, sq, occupied);
+#else
+                return BlackMagicFactory::MagicIndex(p, sq, occupied);
+#endif
+            }
+
+            static const std::array<BitBoard, SlidingSize> Sliding;
 
     };
 
 } // StockDory
 
-std::array<BitBoard, 87988> StockDory::AttackTable::Sliding = []() {
-    std::array<BitBoard, 87988> temp = std::array<BitBoard, 87988>();
+#ifdef STOCKDORY_GENERATED_TABLES
+// Written by generate-tables at build time: the table is constant-initialized into read-only data, so it is shared
+// between processes through the page cache and costs nothing at startup.
+#include "GeneratedSliding.h"
+#else
+const std::array<BitBoard, StockDory::AttackTable::SlidingSize> StockDory::AttackTable::Sliding = []() {
+    std::array<BitBoard, SlidingSize> temp = std::array<BitBoard, SlidingSize>();
 
     const std::array<std::array<std::pair<int8_t, int8_t>, 4>, 2> deltaStride = {{
         {{{ 1,  1 },{ 1, -1 },{ -1, -1 },{ -1,  1 }}}, {{{ 1,  0 },{ 0, -1 },{ -1,  0 },{ 0,  1 }}}
@@ -150,7 +173,7 @@ std::array<BitBoard, 87988> StockDory::AttackTable::Sliding = []() {
                 }
 
                 // List insertion:
-                uint32_t idx = StockDory::BlackMagicFactory::MagicIndex(p, sq, occ);
+                uint32_t idx = StockDory::AttackTable::SlidingIndex(p, sq, occ);
                 temp[idx] = moves;
 
                 // Occupation Recalculation:
@@ -164,5 +187,6 @@ std::array<BitBoard, 87988> StockDory::AttackTable::Sliding = []() {
 
     return temp;
 }();
+#endif
 
 #endif //STOCKDORY_ATTACKTABLE_H
@@ -15,6 +15,7 @@
 #include "../Type/Move.h"
 #include "../Type/PinBitBoard.h"
 #include "../Type/CheckBitBoard.h"
+#include "../Type/AttackContext.h"
 
 #include "../Board.h"
 
@@ -55,7 +56,17 @@ namespace StockDory
                 if (Piece == Piece::Bishop) Bishop(board, sq, pin, check);
                 if (Piece == Piece::Rook  ) Rook  (board, sq, pin, check);
                 if (Piece == Piece::Queen ) Queen (board, sq, pin, check);
-                if (Piece == Piece::King  ) King  (board, sq            );
+                if (Piece == Piece::King  ) King  (board, sq, board.template Threats<Opposite(Color)>());
+            }
+
+            // King moves from an attack context the node has already computed.
+            constexpr MoveList(const Board& board, const AttackContext& context)
+            {
+                static_assert(Piece == Piece::King, "Only king moves are generated from the attack context alone.");
+
+                InternalContainer = BBDefault;
+
+                King(board, context.King, context.Threats);
             }
 
             [[nodiscard]]
@@ -162,7 +173,7 @@ namespace StockDory
             {
                 if (Get(pin.Straight, sq)) return;
 
-                const uint32_t idx = BlackMagicFactory::MagicIndex(Piece, sq, ~board[NAC]);
+                const uint32_t idx = AttackTable::SlidingIndex(Piece, sq, ~board[NAC]);
                 InternalContainer |= AttackTable::Sliding[idx] & ~board[Color] & check.Check;
 
                 if (Get(pin.Diagonal, sq)) InternalContainer &= pin.Diagonal;
@@ -173,7 +184,7 @@ namespace StockDory
             {
                 if (Get(pin.Diagonal, sq)) return;
 
-                const uint32_t idx = BlackMagicFactory::MagicIndex(Piece, sq, ~board[NAC]);
+                const uint32_t idx = AttackTable::SlidingIndex(Piece, sq, ~board[NAC]);
                 InternalContainer |= AttackTable::Sliding[idx] & ~board[Color] & check.Check;
 
                 if (Get(pin.Straight, sq)) InternalContainer &= pin.Straight;
@@ -189,46 +200,42 @@ namespace StockDory
 
                 if        (straight) {
                     const uint32_t idx =
-                            BlackMagicFactory::MagicIndex(Piece::Rook  , sq, ~board[NAC]);
+                            AttackTable::SlidingIndex(Piece::Rook  , sq, ~board[NAC]);
                     InternalContainer |= AttackTable::Sliding[idx ] & ~board[Color] & check.Check & pin.Straight;
 
                 } else if (diagonal) {
                     const uint32_t idx =
-                            BlackMagicFactory::MagicIndex(Piece::Bishop, sq, ~board[NAC]);
+                            AttackTable::SlidingIndex(Piece::Bishop, sq, ~board[NAC]);
                     InternalContainer |= AttackTable::Sliding[idx ] & ~board[Color] & check.Check & pin.Diagonal;
 
                 } else {
                     const uint32_t idxR =
-                            BlackMagicFactory::MagicIndex(Piece::Rook  , sq, ~board[NAC]);
+                            AttackTable::SlidingIndex(Piece::Rook  , sq, ~board[NAC]);
                     InternalContainer |= AttackTable::Sliding[idxR] & ~board[Color] & check.Check;
 
                     const uint32_t idxB =
-                            BlackMagicFactory::MagicIndex(Piece::Bishop, sq, ~board[NAC]);
+                            AttackTable::SlidingIndex(Piece::Bishop, sq, ~board[NAC]);
                     InternalContainer |= AttackTable::Sliding[idxB] & ~board[Color] & check.Check;
                 }
             }
 
-            constexpr inline void King  (const Board&       board, const Square         sq   )
+            constexpr inline void King  (const Board&       board, const Square         sq   ,
+                                         const BitBoard     threats)
             {
-                BitBoard king = AttackTable::King[sq] & ~board[Color];
+                const BitBoard king = AttackTable::King[sq] & ~board[Color] & ~threats;
 
                 if (!king) return;
 
-                auto iterator = BitBoardIterator(king);
-                for (Square target = iterator.Value(); target != NASQ; target = iterator.Value()) {
-                    if (!KingMoveLegal(board, target)) Set<false>(king, target);
-                }
-
                 InternalContainer |= king;
 
-                if (!KingMoveLegal(board, sq)) return;
+                if (Get(threats, sq)) return;
 
                 const bool kingSide  = board.CastlingRightK<Color>();
                 const bool queenSide = board.CastlingRightQ<Color>();
 
                 if (queenSide &&
                     Get(king, static_cast<Square>(sq - 1)) &&
-                    KingMoveLegal(board, static_cast<Square>(sq - 2))) {
+                    !Get(threats, static_cast<Square>(sq - 2))) {
                     const BitBoard path = Color == White ? WhiteQueenCastlePath : BlackQueenCastlePath;
 
                     if (!(path & ~board[NAC])) InternalContainer |= path & QueenCastlePathMask;
@@ -236,35 +243,15 @@ namespace StockDory
 
                 if (kingSide &&
                     Get(king, static_cast<Square>(sq + 1)) &&
-                    KingMoveLegal(board, static_cast<Square>(sq + 2))) {
+                    !Get(threats, static_cast<Square>(sq + 2))) {
                     const BitBoard path = Color == White ? WhiteKingCastlePath : BlackKingCastlePath;
 
                     if (!(path & ~board[NAC])) InternalContainer |= path;
                 }
             }
 
-            constexpr static inline bool KingMoveLegal (const Board& board, const Square target) {
-                constexpr enum Color by = Opposite(Color);
-
-                if (AttackTable::Pawn[Color][target] & board.PieceBoard(Piece::Pawn, by))
-                    return false;
-
-                if (AttackTable::Knight[target] & board.PieceBoard(Piece::Knight, by))
-                    return false;
-
-                const BitBoard occupied = ~board[Color::NAC] & ~board.PieceBoard(Piece::King, Color);
-
-                const BitBoard queen = board.PieceBoard(Piece::Queen, by);
-
-                if (AttackTable::Sliding[BlackMagicFactory::MagicIndex(Piece::Bishop, target, occupied)] &
-                    (queen | board.PieceBoard(Piece::Bishop, by))) return false;
-
-                if (AttackTable::Sliding[BlackMagicFactory::MagicIndex(Piece::Rook  , target, occupied)] &
-                    (queen | board.PieceBoard(Piece::Rook  , by))) return false;
-
-                return !(AttackTable::King[target] & board.PieceBoard(Piece::King, by));
-            }
-
+        public:
+            // Also used by the set-wise pawn generation in SimplifiedMoveList.
             constexpr static inline bool EnPassantLegal(const Board& board,
                                                         const Square ourPawn,
                                                         const Square opponentPawn,
@@ -278,9 +265,9 @@ namespace StockDory
                 const BitBoard queen =              board.PieceBoard(Piece::Queen, Opposite(Color));
                 const Square   king  = ToSquare(board.PieceBoard(Piece::King ,             Color));
 
-                return !((AttackTable::Sliding[BlackMagicFactory::MagicIndex(Piece::Rook  , king, occupied)] &
+                return !((AttackTable::Sliding[AttackTable::SlidingIndex(Piece::Rook  , king, occupied)] &
                          (queen | board.PieceBoard(Piece::Rook  , Opposite(Color)))) ||
-                         (AttackTable::Sliding[BlackMagicFactory::MagicIndex(Piece::Bishop, king, occupied)] &
+                         (AttackTable::Sliding[AttackTable::SlidingIndex(Piece::Bishop, king, occupied)] &
                          (queen | board.PieceBoard(Piece::Bishop, Opposite(Color)))));
             }
 
@@ -0,0 +1,80 @@
+//
+// Copyright (c) 2023 StockDory authors. See the list of authors for more details.
+// Licensed under LGPL-3.0.
+//
+
+#ifndef STOCKDORY_PEXTFACTORY_H
+#define STOCKDORY_PEXTFACTORY_H
+
+#include <array>
+#include <cstdint>
+
+#ifdef STOCKDORY_PEXT
+#ifndef __BMI2__
+#error "STOCKDORY_PEXT needs a BMI2 target (-mbmi2 or -march=native on a BMI2 CPU)."
+#endif
+#include <immintrin.h>
+#endif
+
+#include "../Type/BitBoard.h"
+#include "../Type/Piece.h"
+
+#include "BlackMagicFactory.h"
+
+namespace StockDory
+{
+
+    class PextFactory
+    {
+
+        private:
+            // Same relevant occupancy as black magic: the rays without the square itself and the edge they end on.
+            constexpr static std::array<std::array<BitBoard, 64>, 2> Mask = []() constexpr {
+                std::array<std::array<BitBoard, 64>, 2> temp = {};
+
+                for (uint8_t i = 0; i < 2; i++) for (uint8_t sq = 0; sq < 64; sq++)
+                    temp[i][sq] = ~BlackMagicFactory::Magic[i][sq].first.second;
+
+                return temp;
+            }();
+
+            // Every square gets a dense block of 2^(relevant bits) entries, bishops first.
+            constexpr static std::array<std::array<uint32_t, 64>, 2> Offset = []() constexpr {
+                std::array<std::array<uint32_t, 64>, 2> temp = {};
+
+                uint32_t offset = 0;
+                for (uint8_t i = 0; i < 2; i++) for (uint8_t sq = 0; sq < 64; sq++) {
+                    temp[i][sq] = offset;
+                    offset += 1U << Count(Mask[i][sq]);
+                }
+
+                return temp;
+            }();
+
+        public:
+            constexpr static uint32_t TableSize = Offset[1][63] + (1U << Count(Mask[1][63]));
+
+#ifdef STOCKDORY_PEXT
+            constexpr static inline uint32_t PextIndex(const Piece p, const Square sq, const BitBoard occupied)
+            {
+                const BitBoard mask = Mask[p - 2][sq];
+
+                if consteval {
+                    // Bit by bit extraction for constant evaluation, where the intrinsic is not available.
+                    uint32_t extracted = 0;
+                    uint32_t bit       = 1;
+                    for (BitBoard m = mask; m; m &= m - 1, bit <<= 1)
+                        if (occupied & m & -m) extracted |= bit;
+
+                    return Offset[p - 2][sq] + extracted;
+                } else {
+                    return Offset[p - 2][sq] + static_cast<uint32_t>(_pext_u64(occupied, mask));
+                }
+            }
+#endif
+
+    };
+
+} // StockDory
+
+#endif //STOCKDORY_PEXTFACTORY_H
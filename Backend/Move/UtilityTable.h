@@ -17,13 +17,17 @@ namespace StockDory
     {
 
         public:
-            static std::array<std::array<BitBoard, 64>, 64> Between;
+            static const std::array<std::array<BitBoard, 64>, 64> Between;
 
     };
 
 } // StockDory
 
-std::array<std::array<BitBoard, 64>, 64> StockDory::UtilityTable::Between = []() {
+#ifdef STOCKDORY_GENERATED_TABLES
+// Written by generate-tables at build time, see AttackTable::Sliding.
+#include "GeneratedBetween.h"
+#else
+const std::array<std::array<BitBoard, 64>, 64> StockDory::UtilityTable::Between = []() {
     std::array<std::array<BitBoard, 64>, 64> temp = {};
 
     for (Square f = A1; f != NASQ; f = Next(f)) {
@@ -43,8 +47,8 @@ std::array<std::array<BitBoard, 64>, 64> StockDory::UtilityTable::Between = []()
             if (fH == tH || fV == tV) {
                 occ = FromSquare(f) | FromSquare(t);
 
-                const uint32_t mF = BlackMagicFactory::MagicIndex(Rook, f, occ);
-                const uint32_t mT = BlackMagicFactory::MagicIndex(Rook, t, occ);
+                const uint32_t mF = AttackTable::SlidingIndex(Rook, f, occ);
+                const uint32_t mT = AttackTable::SlidingIndex(Rook, t, occ);
 
                 // Rook squares:
                 temp[f][t] = AttackTable::Sliding[mF] & AttackTable::Sliding[mT];
@@ -62,8 +66,8 @@ std::array<std::array<BitBoard, 64>, 64> StockDory::UtilityTable::Between = []()
             // Bishop squares:
             occ = FromSquare(f) | FromSquare(t);
 
-            const uint32_t mF = BlackMagicFactory::MagicIndex(Bishop, f, occ);
-            const uint32_t mT = BlackMagicFactory::MagicIndex(Bishop, t, occ);
+            const uint32_t mF = AttackTable::SlidingIndex(Bishop, f, occ);
+            const uint32_t mT = AttackTable::SlidingIndex(Bishop, t, occ);
 
             temp[f][t] = AttackTable::Sliding[mF] & AttackTable::Sliding[mT];
         }
@@ -71,5 +75,6 @@ std::array<std::array<BitBoard, 64>, 64> StockDory::UtilityTable::Between = []()
 
     return temp;
 }();
+#endif
 
 #endif //STOCKDORY_UTILITYTABLE_H
@@ -6,14 +6,24 @@
 #ifndef STOCKDORY_TRANSPOSITIONTABLE_H
 #define STOCKDORY_TRANSPOSITIONTABLE_H
 
-#include <vector>
 #include <algorithm>
-#include <execution>
+#include <bit>
+#include <cstdint>
+#include <fstream>
+#include <new>
+#include <string>
+#include <utility>
 
 #ifdef __x86_64__
 #include <xmmintrin.h>
 #endif
 
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 #include "Type/Zobrist.h"
 
 #include "../External/fastrange.h"
@@ -21,30 +31,148 @@
 namespace StockDory
 {
 
+    enum class TablePages : uint8_t
+    {
+        Normal     , // heap memory, off Linux
+        Small      , // 4 KB pages, the kernel refused huge pages
+        Transparent, // MADV_HUGEPAGE, the kernel backs the table with 2 MB pages when it can
+        Huge         // MAP_HUGETLB, explicitly reserved huge pages
+    };
+
+    // The table is mapped straight from the kernel: with huge pages a random probe no longer misses the TLB as well as
+    // the cache. Interleaved, its pages are spread round robin over the NUMA nodes, so the threads of every node share
+    // the memory bandwidth of all of them. Clear runs on the OpenMP team (the search threads).
+    // NewSearch only advances the generation the entries are stored with, so a new search ages the old ones instead of
+    // paying for a Clear.
     template<typename T>
     class TranspositionTable
     {
 
         private:
-            std::vector<T> Internal;
-            uint64_t Count = 0;
+            static constexpr uint64_t HugePageSize = 2 * 1024 * 1024;
+
+            T*         Internal   = nullptr;
+            uint64_t   Count      = 0;
+            uint64_t   Mapped     = 0;
+            bool       Interleave = false;
+            TablePages Pages      = TablePages::Normal;
+            uint8_t    Current    = 0;
+
+            void Allocate()
+            {
+                Mapped = (std::max<uint64_t>(Count, 1) * sizeof(T) + HugePageSize - 1) / HugePageSize * HugePageSize;
+
+#ifdef __linux__
+                void* memory = mmap(nullptr, Mapped, PROT_READ | PROT_WRITE,
+                                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+                Pages = TablePages::Huge;
+
+                if (memory == MAP_FAILED) {
+                    // Over-map by a huge page so the table can start on a huge page boundary
+                    const uint64_t size = Mapped + HugePageSize;
+                    auto* raw = static_cast<uint8_t*>(mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                                                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+                    if (raw == MAP_FAILED) throw std::bad_alloc();
+
+                    const uint64_t offset = (HugePageSize - reinterpret_cast<uintptr_t>(raw) % HugePageSize)
+                                          % HugePageSize;
+                    if (offset > 0) munmap(raw, offset);
+                    munmap(raw + offset + Mapped, HugePageSize - offset);
+
+                    memory = raw + offset;
+                    Pages  = madvise(memory, Mapped, MADV_HUGEPAGE) == 0 ? TablePages::Transparent : TablePages::Small;
+                }
+
+                if (Interleave) InterleaveNodes(memory);
+
+                Internal = static_cast<T*>(memory);
+#else
+                Internal = static_cast<T*>(::operator new(Mapped, std::align_val_t(64)));
+                Pages    = TablePages::Normal;
+#endif
+            }
+
+            void Free()
+            {
+                if (Internal == nullptr) return;
+
+#ifdef __linux__
+                munmap(Internal, Mapped);
+#else
+                ::operator delete(Internal, std::align_val_t(64));
+#endif
+                Internal = nullptr;
+            }
+
+#ifdef __linux__
+            // Only sets the policy, the pages are placed when Clear first touches them
+            void InterleaveNodes(void* memory) const
+            {
+                std::ifstream online("/sys/devices/system/node/online");
+                std::string   nodes;
+                if (!online || !std::getline(online, nodes)) return;
+
+                // "0-1" or "0,2-3": nodes up to 63 are plenty for a mask of one word
+                uint64_t mask = 0;
+                size_t   begin = 0;
+                while (begin < nodes.size()) {
+                    const size_t end   = std::min(nodes.find(',', begin), nodes.size());
+                    const size_t dash  = nodes.find('-', begin);
+                    const int    first = std::stoi(nodes.substr(begin, end - begin));
+                    const int    last  = dash < end ? std::stoi(nodes.substr(dash + 1, end - dash - 1)) : first;
+                    for (int node = first; node <= last && node < 64; node++) mask |= 1ULL << node;
+                    begin = end + 1;
+                }
+
+                // MPOL_INTERLEAVE, without linking libnuma for it
+                constexpr int interleave = 3;
+                if (std::popcount(mask) > 1) syscall(SYS_mbind, memory, Mapped, interleave, &mask, 64, 0);
+            }
+#endif
 
         public:
-            explicit TranspositionTable(const uint64_t bytes)
+            explicit TranspositionTable(const uint64_t bytes, const bool interleave = false) : Interleave(interleave)
             {
                 Resize(bytes);
             }
 
+            ~TranspositionTable()
+            {
+                Free();
+            }
+
+            TranspositionTable(const TranspositionTable&) = delete;
+
+            TranspositionTable& operator =(const TranspositionTable&) = delete;
+
             void Resize(const uint64_t bytes)
             {
+                Free();
                 Count = bytes / sizeof(T);
+                Allocate();
 
                 Clear();
             }
 
+            // Every thread of the team constructs (and so first touches) a contiguous slice of the table
             void Clear()
             {
-                Internal = std::vector<T>(Count);
+                T* const       internal = Internal;
+                const uint64_t count    = Count;
+
+                #pragma omp parallel for schedule(static)
+                for (uint64_t i = 0; i < count; i++) new (&internal[i]) T();
+            }
+
+            inline void NewSearch()
+            {
+                Current++;
+            }
+
+            [[nodiscard]]
+            inline uint8_t Generation() const
+            {
+                return Current;
             }
 
             inline T& operator [](const ZobristHash hash)
@@ -71,7 +199,13 @@ namespace StockDory
             [[nodiscard]]
             inline uint64_t Size() const
             {
-                return Internal.size();
+                return Count;
+            }
+
+            [[nodiscard]]
+            inline TablePages Backing() const
+            {
+                return Pages;
             }
 
     };
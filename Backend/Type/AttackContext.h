@@ -0,0 +1,36 @@
+//
+// Copyright (c) 2023 StockDory authors. See the list of authors for more details.
+// Licensed under LGPL-3.0.
+//
+
+#ifndef STOCKDORY_ATTACKCONTEXT_H
+#define STOCKDORY_ATTACKCONTEXT_H
+
+#include "BitBoard.h"
+#include "Square.h"
+#include "PinBitBoard.h"
+#include "CheckBitBoard.h"
+
+// Everything a node needs to know about the attacks on the side to move, computed once by Board::Attacks and shared
+// by move generation and the mate, stalemate and check tests of the searches.
+struct AttackContext
+{
+
+    public:
+        Square        King     = NASQ     ;
+        BitBoard      Checkers = BBDefault;
+        PinBitBoard   Pin                 ;
+        CheckBitBoard Check               ;
+
+        // Every square the opponent attacks, with our king lifted off the board so it cannot hide behind itself.
+        BitBoard      Threats  = BBDefault;
+
+        [[nodiscard]]
+        constexpr inline bool InCheck() const
+        {
+            return Checkers != BBDefault;
+        }
+
+};
+
+#endif //STOCKDORY_ATTACKCONTEXT_H
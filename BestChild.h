@@ -0,0 +1,113 @@
+//
+// Lock-free result merging for the parallel searches.
+// BestChild is a per-thread (best score, index, line) slot that OpenMP reductions merge at the end of a loop,
+// AtomicBest packs score and index into one word for tasks, and AtomicMax publishes alpha.
+// Ties go to the lower move index so the result does not depend on which thread finished first. A child that failed
+// low against the alpha it was searched with only returned an upper bound, so it never wins a tie against a real score.
+//
+
+#ifndef STOCKDORY_BESTCHILD_H
+#define STOCKDORY_BESTCHILD_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include "Backend/Type/Move.h"
+
+namespace StockDory
+{
+
+    template<int MaxDepth>
+    struct BestChild
+    {
+        int  Score = -50000;
+        bool Exact = false;
+        int  Index = 256;
+        std::array<Move, MaxDepth> Line = {};
+
+        inline void Update(const int index, const Move move, const int score, const bool exact,
+                           const std::array<Move, MaxDepth>& childLine, const int depth)
+        {
+            if (!Better(score, exact, index)) return;
+
+            Score   = score;
+            Exact   = exact;
+            Index   = index;
+            Line[0] = move ;
+            for (int j = 0; j < depth - 1; j++) Line[j + 1] = childLine[j];
+        }
+
+        inline void Merge(const BestChild& other)
+        {
+            if (Better(other.Score, other.Exact, other.Index)) *this = other;
+        }
+
+    private:
+        [[nodiscard]]
+        inline bool Better(const int score, const bool exact, const int index) const
+        {
+            if (score != Score) return score > Score;
+            if (exact != Exact) return exact;
+            return index < Index;
+        }
+    };
+
+    class AtomicBest
+    {
+
+    private:
+        // [ SCORE + BIAS ] [ UNUSED ] [ EXACT ] [ 255 - INDEX ]
+        // [   32 BITS    ] [23 BITS ] [ 1 BIT ] [   8 BITS    ]
+        static constexpr int64_t Bias = 1LL << 30;
+
+        std::atomic<uint64_t> Internal;
+
+        static constexpr inline uint64_t Pack(const int score, const bool exact, const uint8_t index)
+        {
+            return static_cast<uint64_t>(score + Bias) << 32 | static_cast<uint64_t>(exact) << 8 |
+                   static_cast<uint64_t>(255 - index);
+        }
+
+    public:
+        explicit AtomicBest(const int score, const uint8_t index = 255) : Internal(Pack(score, true, index)) {}
+
+        // Returns true if the offer became the new best.
+        inline bool Offer(const int score, const bool exact, const uint8_t index)
+        {
+            const uint64_t packed  = Pack(score, exact, index);
+                  uint64_t current = Internal.load(std::memory_order_relaxed);
+
+            while (packed > current)
+                if (Internal.compare_exchange_weak(current, packed, std::memory_order_relaxed)) return true;
+
+            return false;
+        }
+
+        [[nodiscard]]
+        inline int Score() const
+        {
+            return static_cast<int>(static_cast<int64_t>(Internal.load(std::memory_order_relaxed) >> 32) - Bias);
+        }
+
+        [[nodiscard]]
+        inline uint8_t Index() const
+        {
+            return 255 - static_cast<uint8_t>(Internal.load(std::memory_order_relaxed) & 0xFF);
+        }
+    };
+
+    // Raises target to value, returns true if this call raised it.
+    inline bool AtomicMax(std::atomic<int>& target, const int value)
+    {
+        int current = target.load(std::memory_order_relaxed);
+
+        while (current < value)
+            if (target.compare_exchange_weak(current, value, std::memory_order_relaxed)) return true;
+
+        return false;
+    }
+
+} // StockDory
+
+#endif //STOCKDORY_BESTCHILD_H
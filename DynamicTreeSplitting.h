@@ -0,0 +1,130 @@
+//
+// Explicit search stacks and split points for the Dynamic Tree Splitting (DTS) search.
+// Each thread searches with its own array of frames instead of the C++ call stack, so a busy thread can turn any
+// frame of its stack into a split point (not only the node it is currently at) when other threads are idle.
+//
+
+#ifndef STOCKDORY_DYNAMICTREESPLITTING_H
+#define STOCKDORY_DYNAMICTREESPLITTING_H
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "Backend/Board.h"
+#include "Backend/Type/Move.h"
+#include "Backend/Type/PreviousState.h"
+
+namespace StockDory
+{
+
+    // Frames beyond maxDepth are only reached through check extensions.
+    constexpr int DTSExtraFrames = 8;
+
+    template<int MaxDepth>
+    struct DTSSplitPoint
+    {
+        std::mutex Lock;
+
+        // Position at the split node, helpers copy it once and make their moves on the copy.
+        Board Position;
+
+        std::array<Move, 256> Moves = {};
+        uint8_t Count = 0;
+        uint8_t Next  = 0;
+
+        int Alpha      = 0;
+        int Beta       = 0;
+        int Depth      = 0;
+        int Ply        = 0;
+        int Extensions = 0;
+
+        int BestScore = 0;
+        std::array<Move, MaxDepth> BestLine = {};
+
+        // Helpers currently searching moves of this split point, not counting the owner.
+        std::atomic<int>  Helpers = 0;
+        std::atomic<bool> Cutoff  = false;
+        std::atomic<bool> Active  = false;
+
+        // Split point the owner was working under when it split, a cutoff there aborts this one too.
+        DTSSplitPoint* Parent = nullptr;
+
+        [[nodiscard]]
+        inline bool Aborted() const
+        {
+            for (const DTSSplitPoint* sp = this; sp != nullptr; sp = sp->Parent)
+                if (sp->Cutoff.load(std::memory_order_relaxed)) return true;
+
+            return false;
+        }
+
+        [[nodiscard]]
+        inline bool DescendsFrom(const DTSSplitPoint* ancestor) const
+        {
+            for (const DTSSplitPoint* sp = this; sp != nullptr; sp = sp->Parent)
+                if (sp == ancestor) return true;
+
+            return false;
+        }
+    };
+
+    template<int MaxDepth>
+    struct DTSFrame
+    {
+        std::array<Move, 256> Moves = {};
+        uint8_t Count = 0;
+        uint8_t Next  = 0;
+
+        int Alpha      = 0;
+        int Beta       = 0;
+        int Depth      = 0;
+        int Ply        = 0;
+        int Extensions = 0;
+
+        int BestScore = 0;
+        std::array<Move, MaxDepth> BestLine = {};
+
+        // Move being searched below this frame and the state needed to take it back.
+        Move          Current  = {};
+        PreviousState Previous = PreviousState(PieceColor(), PieceColor(), NASQ, 0, 0);
+
+        // Set once the frame has been published, its moves and bounds then live in the split point.
+        DTSSplitPoint<MaxDepth>* Split = nullptr;
+
+        inline void Reset(const int alpha, const int beta, const int depth, const int ply, const int extensions)
+        {
+            Alpha      = alpha;
+            Beta       = beta;
+            Depth      = depth;
+            Ply        = ply;
+            Extensions = extensions;
+            Count      = 0;
+            Next       = 0;
+            BestScore  = -50000;
+            BestLine   = {};
+            Split      = nullptr;
+        }
+    };
+
+    template<int MaxDepth>
+    struct DTSThread
+    {
+        std::array<DTSFrame     <MaxDepth>, MaxDepth + DTSExtraFrames> Frames;
+        // Frame i can only ever publish split point i, so the slots never need allocating.
+        std::array<DTSSplitPoint<MaxDepth>, MaxDepth + DTSExtraFrames> SplitPoints;
+    };
+
+    template<int MaxDepth>
+    struct DTSShared
+    {
+        std::vector<DTSThread<MaxDepth>*> Threads;
+
+        std::atomic<int>  Idle     = 0;
+        std::atomic<bool> Finished = false;
+    };
+
+} // StockDory
+
+#endif //STOCKDORY_DYNAMICTREESPLITTING_H
@@ -6,6 +6,10 @@
 #define ENGINE_H
 #include <limits>
 #include <atomic>
+#include <memory>
+#include <thread>
+#include <optional>
+#include <vector>
 #include "Backend/Board.h"
 #include "Backend/Type/Move.h"
 #include "Backend/Type/Color.h"
@@ -16,697 +20,921 @@
 
 
 #include "SimplifiedMoveList.h"
+#include "OrderedMoveList.h"
+#include "HashEntry.h"
+#include "DynamicTreeSplitting.h"
+#include "BestChild.h"
+#include "MakePolicy.h"
+#include "SearchStats.h"
+#include "SearchTrace.h"
+#include "SearchPolicy.h"
+#include "Backend/TranspositionTable.h"
 
+//MakePolicy picks copy-make or make/unmake for the recursive searches, see MakePolicy.h
+//Stats counts nodes, cutoffs, splits and the rest of the search statistics, or compiles them out, see SearchStats.h
+//Trace records the splits of the parallel searches on a timeline, or compiles it out, see SearchTrace.h
+template<typename MakePolicy = StockDory::DefaultMakePolicy, typename Stats = StockDory::NoSearchStats, typename Trace = StockDory::NoSearchTrace>
 class Engine {
     private:
         Evaluation evaluation;
         int numThreads = 8;
         int mateScore = 20000;
+        //losing captures are only searched above this depth
+        int seePruneDepth = 1;
+        //plies a single line may be extended by checks
+        int maxCheckExtensions = 4;
+        //internal iterative deepening runs at this depth and above, searching this many plies shallower
+        int iidDepth = 3;
+        int iidReduction = 2;
+        //returned by an exclusive ABDADA node that another thread is already searching
+        int abdadaBusy = 60000;
+        //DTS only splits frames with at least this much depth left
+        int dtsSplitDepth = 2;
+        //task-based YBWC searches sequentially below this depth
+        int taskSequentialDepth = 3;
+        //shared by every ABDADA thread, so its pages are interleaved over the NUMA nodes. Mapped by the first ABDADA search,
+        //an engine that never runs one allocates nothing
+        std::unique_ptr<StockDory::TranspositionTable<StockDory::HashCluster>> abdadaTable;
 
-    public:
-        template<Color color>
-        int minimaxMoveCounter(StockDory::Board &chessBoard, int depth) {
-            int sum = 0;
-            if (chessBoard.ColorToMove() == White) {
-                const StockDory::SimplifiedMoveList<White> moveList(chessBoard);
+        //mate scores are stored relative to the node so they stay correct when reached at another ply
+        int scoreToHash(int score, int ply) {
+            if (score >= mateScore - 1000) {
+                return score + ply;
+            }
+            if (score <= -mateScore + 1000) {
+                return score - ply;
+            }
+            return score;
+        }
 
-                // Add check for no legal moves
-                if (moveList.Count() == 0 and chessBoard.Checked<color>()) {
-                    return 0;
-                }
-                else if (moveList.Count() == 0) {
-                    // No legal moves
-                    int score = evaluation.eval(chessBoard);
-                    return 0;
-                }
+        int scoreFromHash(int score, int ply) {
+            if (score >= mateScore - 1000) {
+                return score - ply;
+            }
+            if (score <= -mateScore + 1000) {
+                return score + ply;
+            }
+            return score;
+        }
 
-                if (depth == 0) {
-                    int score = evaluation.eval(chessBoard);
-                    return 0;
-                }
-                constexpr Color Ocolor = Opposite(color);
-                sum += moveList.Count();
-                for (uint8_t i = 0; i < moveList.Count(); i++) {
-                    Move nextMove = moveList[i];
-                    Square from = nextMove.From();
-                    Square to = nextMove.To();
-                    Piece promotion = nextMove.Promotion();
-                    // Perform move
-                    PreviousState prevState = chessBoard.Move<0>(from, to, promotion);
-                    sum += minimaxMoveCounter<Ocolor>(chessBoard, depth-1);
-                    // Undo move
-                    chessBoard.UndoMove<0>(prevState, from, to);
-                }
+        //every static evaluation goes through here so the leaves are counted
+        int evaluate(const StockDory::Board &chessBoard) {
+            Stats::Add(StockDory::StatLeafEvals);
+            typename Stats::Phase phase(StockDory::PhaseEval);
+            return evaluation.eval(chessBoard);
+        }
+
+        //the kernel and the quiescence search make and take back their moves through here, a phase of the perf counters
+        template<MoveType T = 0>
+        typename MakePolicy::Child make(StockDory::Board &chessBoard, int ply, Square from, Square to, Piece promotion) {
+            typename Stats::Phase phase(StockDory::PhaseMakeUnmake);
+            return MakePolicy::template Make<T>(chessBoard, ply, from, to, promotion);
+        }
+
+        template<MoveType T = 0>
+        void undo(StockDory::Board &chessBoard, const typename MakePolicy::Child &child, Square from, Square to) {
+            typename Stats::Phase phase(StockDory::PhaseMakeUnmake);
+            MakePolicy::template Undo<T>(chessBoard, child, from, to);
+        }
+
+        //a fail high, and whether the first move searched already caused it (how good the move ordering is)
+        void cutoff(bool firstMove) {
+            Stats::Add(StockDory::StatBetaCutoffs);
+            if (firstMove) {
+                Stats::Add(StockDory::StatFirstMoveCutoffs);
             }
-            // Black's turn
-            else {
-                const StockDory::SimplifiedMoveList<Black> moveList(chessBoard);
-                // Add check for no legal moves
-                if (moveList.Count() == 0 and chessBoard.Checked<color>()) {
-                    return 0;
-                }
-                else if (moveList.Count() == 0) {
-                    // No legal moves
-                    int score = evaluation.eval(chessBoard);
-                    return 0;
-                }
+        }
 
-                if (depth == 0) {
-                    int score = evaluation.eval(chessBoard);
-                    return 0;
-                }
-                constexpr Color Ocolor = Opposite(color);
-                sum += moveList.Count();
-                for (uint8_t i = 0; i < moveList.Count(); i++) {
-                    Move nextMove = moveList[i];
-                    Square from = nextMove.From();
-                    Square to = nextMove.To();
-                    Piece promotion = nextMove.Promotion();
-                    // Perform move
-                    PreviousState prevState = chessBoard.Move<0>(from, to, promotion);
-                    sum += minimaxMoveCounter<Ocolor>(chessBoard, depth-1);
-                    // Undo move
-                    chessBoard.UndoMove<0>(prevState, from, to);
+        //called by every thread of a parallel region, counts the region once if it really runs on more than one thread
+        void countSplit() {
+            if constexpr (Stats::Enabled) {
+                if (omp_get_thread_num() == 0 && omp_get_num_threads() > 1) {
+                    Stats::Add(StockDory::StatSplits);
                 }
             }
-            return sum;
         }
-        //minimax implementation
-        template<Color color, int maxDepth>
-        std::pair<std::array<Move, maxDepth>, int> minimax(StockDory::Board &chessBoard, int depth) {
-            std::array<Move, maxDepth> bestLine;
-            int bestScore;
-            int bestLineSize;
-            // Base case
 
-            // White's turn
-            if (chessBoard.ColorToMove() == White) {
-                bestScore = -50000;
-                const StockDory::SimplifiedMoveList<White> moveList(chessBoard);
+        //the clock of the statistics and the trace, a constant when neither is compiled in
+        static uint64_t now() {
+            if constexpr (Stats::Enabled) {
+                return Stats::Now();
+            }
+            return Trace::Now();
+        }
 
-                // Add check for no legal moves
-                if (moveList.Count() == 0 and chessBoard.Checked<color>()) {
-                    return std::make_pair(std::array<Move, maxDepth>(), -mateScore-depth);
+        //capture-only search at the horizon so the static eval is not taken in the middle of an exchange
+        template<Color color>
+        int quiescence(StockDory::Board &chessBoard, int alpha, int beta, int ply) {
+            Stats::Add(StockDory::StatNodes);
+            int standPat = evaluate(chessBoard);
+            //flip the score for black since we are maximizing
+            if (color == Black) {
+                standPat *= -1;
+            }
+            if (standPat >= beta) {
+                return standPat;
+            }
+            alpha = std::max(alpha, standPat);
+            int bestScore = standPat;
+            constexpr Color Ocolor = Opposite(color);
+            typename Stats::Phase generation(StockDory::PhaseMoveGen);
+            const StockDory::OrderedMoveList<color, true> captures(chessBoard);
+            generation.Stop();
+            for (uint8_t i = 0; i < captures.Count(); i++) {
+                //losing captures are sorted last, none of them can raise the stand pat
+                if (captures.LosingCapture(i)) {
+                    break;
                 }
-                else if (moveList.Count() == 0) {
-                    // No legal moves
-                    int score = evaluation.eval(chessBoard);
-                    return std::make_pair(std::array<Move, maxDepth>(), 0);
+                Move nextMove = captures[i];
+                Square from = nextMove.From();
+                Square to = nextMove.To();
+                typename MakePolicy::Child child = make(chessBoard, ply, from, to, nextMove.Promotion());
+                int score = -quiescence<Ocolor>(child.Position, -beta, -alpha, ply + 1);
+                undo(chessBoard, child, from, to);
+                bestScore = std::max(bestScore, score);
+                alpha = std::max(alpha, score);
+                if (alpha >= beta) {
+                    break;
                 }
+            }
+            return bestScore;
+        }
 
-                if (depth == 0) {
-                    int score = evaluation.eval(chessBoard);
-                    return std::make_pair(std::array<Move, maxDepth>(), score);
-                }
-                constexpr Color Ocolor = Opposite(color);
+        //skip a losing capture near the horizon unless we are in check or it gives check (it may be the mating move)
+        template<Color color>
+        bool seePrune(StockDory::Board &chessBoard, const StockDory::OrderedMoveList<color> &moveList, uint8_t i, int depth, int ply, bool inCheck) {
+            if (depth > seePruneDepth || i == 0 || !moveList.LosingCapture(i) || inCheck) {
+                return false;
+            }
+            Move move = moveList[i];
+            typename MakePolicy::Child child = make(chessBoard, ply, move.From(), move.To(), move.Promotion());
+            StockDory::Board &position = child.Position;
+            bool givesCheck = position.Checked<Opposite(color)>();
+            undo(chessBoard, child, move.From(), move.To());
+            return !givesCheck;
+        }
 
-                for (uint8_t i = 0; i < moveList.Count(); i++) {
-                    Move nextMove = moveList[i];
-                    Square from = nextMove.From();
-                    Square to = nextMove.To();
-                    Piece promotion = nextMove.Promotion();
-                    // Perform move
-                    PreviousState prevState = chessBoard.Move<0>(from, to, promotion);
-                    std::pair<std::array<Move, maxDepth>, int> result = minimax<Ocolor, maxDepth>(chessBoard, depth-1);
-                    // Update best score
-                    if (bestScore < result.second) {
-                        bestScore = result.second;
-                        bestLine[0] = nextMove;
-                        bestLineSize = 1;
-                        for (int j = 0; j < depth - 1; j++) {
-                            bestLine[bestLineSize++] = result.first[j];
-                        }
-                    }
-                    // Undo move
-                    chessBoard.UndoMove<0>(prevState, from, to);
+        //internal iterative deepening: without a winning capture to lead with, a reduced-depth search picks the eldest brother
+        template<Color color, int maxDepth>
+        void iidOrder(StockDory::Board &chessBoard, StockDory::OrderedMoveList<color> &moveList, int alpha, int beta, int depth, int ply, int extensions) {
+            if (depth < iidDepth || moveList.Count() < 2 || moveList.WinningCapture(0)) {
+                return;
+            }
+            std::pair<std::array<Move, maxDepth>, int> result = alphaBetaNega<color, maxDepth>(chessBoard, alpha, beta, depth - iidReduction, ply, extensions);
+            for (uint8_t i = 1; i < moveList.Count(); i++) {
+                if (moveList[i] == result.first[0]) {
+                    moveList.Promote(i);
+                    return;
                 }
             }
-            // Black's turn
-            else {
-                bestScore = 50000;
-                const StockDory::SimplifiedMoveList<Black> moveList(chessBoard);
+        }
 
-                // Add check for no legal moves
-                if (moveList.Count() == 0 and chessBoard.Checked<color>()) {
-                    return std::make_pair(std::array<Move, maxDepth>(), mateScore+depth);
+        //the alpha-beta node every recursive variant is built from. Split (see SearchPolicy.h) decides at compile time how
+        //the moves are shared between threads, whether internal iterative deepening orders them and whether the ABDADA
+        //hash table is used, exclusive is only read with the table
+        template<typename Split, Color color, int maxDepth>
+        std::pair<std::array<Move, maxDepth>, int> search(StockDory::Board &chessBoard, int alpha, int beta, int depth, int ply, int extensions, bool exclusive = false) {
+            static_assert(!(Split::Parallel && Split::Table), "hash table nodes search their moves on the thread's own board");
+            Stats::Add(StockDory::StatNodes);
+            std::array<Move, maxDepth> bestLine;
+            int bestScore = -50000;
+            //mate distance pruning: no line from here can beat a mate already found closer to the root
+            alpha = std::max(alpha, -mateScore + ply);
+            beta = std::min(beta, mateScore - ply - 1);
+            if (alpha >= beta) {
+                return std::make_pair(std::array<Move, maxDepth>(), alpha);
+            }
+            const ZobristHash hash = Split::Table ? chessBoard.Zobrist() : 0;
+            StockDory::HashCluster *entry = nullptr;
+            if constexpr (Split::Table) {
+                typename Stats::Phase probing(StockDory::PhaseHashProbe);
+                entry = &(*abdadaTable)[hash];
+                //another thread is on this position, the parent will come back to it after the other siblings
+                if (exclusive && entry->Busy(hash)) {
+                    return std::make_pair(std::array<Move, maxDepth>(), abdadaBusy);
                 }
-                else if (moveList.Count() == 0) {
-                    // No legal moves
-                    int score = evaluation.eval(chessBoard);
-                    return std::make_pair(std::array<Move, maxDepth>(), 0);
+            }
+            typename Stats::Phase attacking(StockDory::PhaseMoveGen);
+            const AttackContext attacks = chessBoard.Attacks<color>();
+            const bool inCheck = attacks.InCheck();
+            //check extension: keep searching forcing lines instead of stopping while in check
+            if (inCheck && extensions < maxCheckExtensions && depth < maxDepth) {
+                depth++;
+                extensions++;
+            }
+            //base-case -> when depth is 0, we resolve pending captures and return a default move (which will be overrided in the parent call)
+            if (depth == 0) {
+                //mate or stalemate at the horizon only needs to know whether any legal move exists
+                if (!StockDory::HasLegalMove<color>(chessBoard, attacks)) {
+                    return std::make_pair(std::array<Move, maxDepth>(), inCheck ? -mateScore + ply : 0);
                 }
-
-                if (depth == 0) {
-                    int score = evaluation.eval(chessBoard);
-                    return std::make_pair(std::array<Move, maxDepth>(), score);
+                attacking.Stop();
+                return std::make_pair(std::array<Move, maxDepth>(), quiescence<color>(chessBoard, alpha, beta, ply));
+            }
+            attacking.Stop();
+            //probed before the moves are generated, so a cutoff saves generating them
+            StockDory::HashData hashData;
+            bool hit = false;
+            if constexpr (Split::Table) {
+                Stats::Add(StockDory::StatHashProbes);
+                typename Stats::Phase probing(StockDory::PhaseHashProbe);
+                hit = entry->Probe(hash, hashData);
+                probing.Stop();
+                if (hit) {
+                    Stats::Add(StockDory::StatHashHits);
+                    int hashScore = scoreFromHash(hashData.Score, ply);
+                    //never cut at the root, the caller needs a move from this search
+                    if (ply > 0 && hashData.Depth >= depth && (hashData.Type == StockDory::BoundExact ||
+                        (hashData.Type == StockDory::BoundLower && hashScore >= beta) ||
+                        (hashData.Type == StockDory::BoundUpper && hashScore <= alpha))) {
+                        bestLine[0] = hashData.BestMove;
+                        return std::make_pair(bestLine, hashScore);
+                    }
                 }
-                constexpr Color Ocolor = Opposite(color);
-
-                for (uint8_t i = 0; i < moveList.Count(); i++) {
-                    Move nextMove = moveList[i];
-                    Square from = nextMove.From();
-                    Square to = nextMove.To();
-                    Piece promotion = nextMove.Promotion();
-                    // Perform move
-                    PreviousState prevState = chessBoard.Move<0>(from, to, promotion);
-                    std::pair<std::array<Move, maxDepth>, int> result = minimax<Ocolor, maxDepth>(chessBoard, depth-1);
-                    // Update best score
-                    if (bestScore > result.second) {
-                        bestScore = result.second;
-                        bestLine[0] = nextMove;
-                        bestLineSize = 1;
-                        for (int j = 0; j < depth - 1; j++) {
-                            bestLine[bestLineSize++] = result.first[j];
-                        }
+            }
+            typename Stats::Phase generation(StockDory::PhaseMoveGen);
+            // create move list for player
+            const StockDory::SimplifiedMoveList<color> legalMoves(chessBoard, attacks);
+            //check for mate
+            if (legalMoves.Count() == 0 and inCheck) {
+                return std::make_pair(std::array<Move, maxDepth>(), -mateScore + ply);
+            }
+            //stalemate
+            else if (legalMoves.Count() == 0){
+                return std::make_pair(std::array<Move, maxDepth>(), 0);
+            }
+            //winning captures first, losing captures last
+            StockDory::OrderedMoveList<color> moveList(chessBoard, legalMoves);
+            generation.Stop();
+            //the best move of an earlier iteration (or another thread) is searched first
+            if (Split::Table && hit) {
+                for (uint8_t i = 1; i < moveList.Count(); i++) {
+                    if (moveList[i] == hashData.BestMove) {
+                        moveList.Promote(i);
+                        break;
                     }
-                    // Undo move
-                    chessBoard.UndoMove<0>(prevState, from, to);
                 }
             }
+            if constexpr (Split::IID) {
+                iidOrder<color, maxDepth>(chessBoard, moveList, alpha, beta, depth, ply, extensions);
+            }
 
-            return std::make_pair(bestLine, bestScore);
-        }
-
-        template<Color color, int maxDepth>
-        std::pair<std::array<Move, maxDepth>, int> parallelMinimax(StockDory::Board &chessBoard, int depth) {
-            // Local variables
-            std::array<Move, maxDepth> bestLine;
-            int bestScore;
-            int bestLineSize;
-            // Base case
+            constexpr enum Color Ocolor = Opposite(color);
+            //the table needs the child's hash, the other nodes never read it
+            constexpr MoveType makeType = Split::Table ? ZOBRIST : 0;
+            constexpr MoveType youngerMakeType = Split::Younger::Table ? ZOBRIST : 0;
+            const int originalAlpha = alpha;
 
-            // White's turn
-            if (chessBoard.ColorToMove() == White) {
-                bestScore = -50000;
-                const StockDory::SimplifiedMoveList<White> moveList(chessBoard);
+            //search move i on the node's own board, false if it was an exclusive ABDADA child another thread is busy with
+            auto searchMove = [&](uint8_t i, bool exclusiveChild) {
+                Move nextMove = moveList[i];
+                Square from = nextMove.From();
+                Square to = nextMove.To();
+                typename MakePolicy::Child child = make<makeType>(chessBoard, ply, from, to, nextMove.Promotion());
+                //the child's cluster is on its way while the child generates its attacks
+                if constexpr (Split::Table) {
+                    abdadaTable->Prefetch(child.Position.Zobrist());
+                }
+                std::pair<std::array<Move, maxDepth>, int> result = search<Split, Ocolor, maxDepth>(child.Position, -beta, -alpha, depth - 1, ply + 1, extensions, exclusiveChild);
+                undo<makeType>(chessBoard, child, from, to);
+                result.second = -result.second;
+                if (Split::Table && result.second == -abdadaBusy) {
+                    return false;
+                }
+                if (result.second > bestScore) {
+                    bestScore = result.second;
+                    //create chess line with the current move as the head
+                    bestLine[0] = nextMove;
+                    for (int j = 0; j < depth - 1; j++) {
+                        bestLine[j + 1] = result.first[j];
+                    }
+                    alpha = std::max(alpha, bestScore);
+                    if (alpha >= beta) {
+                        cutoff(i == 0);
+                    }
+                }
+                return true;
+            };
 
-                // Add check for no legal moves
-                if (moveList.Count() == 0 and chessBoard.Checked<color>()) {
-                    return std::make_pair(std::array<Move, maxDepth>(), -mateScore-depth);
+            if constexpr (Split::Table) {
+                entry->Enter(hash);
+            }
+            //every move of a sequential node, or the eldest brother of a node that splits after it
+            const uint8_t sequentialCount = !Split::Parallel ? moveList.Count() : Split::EldestFirst ? 1 : 0;
+            std::array<uint8_t, 256> deferred;
+            uint8_t deferredCount = 0;
+            for (uint8_t i = 0; i < sequentialCount && alpha < beta; i++) {
+                if (seePrune<color>(chessBoard, moveList, i, depth, ply, inCheck)) {
+                    continue;
                 }
-                else if (moveList.Count() == 0) {
-                    // No legal moves
-                    int score = evaluation.eval(chessBoard);
-                    return std::make_pair(std::array<Move, maxDepth>(), 0);
+                //the eldest brother is never deferred
+                if (!searchMove(i, Split::Table && i > 0)) {
+                    deferred[deferredCount++] = i;
+                }
+            }
+            if constexpr (Split::Table) {
+                //the busy siblings are searched once everything else is done
+                for (uint8_t k = 0; k < deferredCount && alpha < beta; k++) {
+                    searchMove(deferred[k], false);
                 }
+                entry->Leave(hash);
+                StockDory::Bound bound = bestScore <= originalAlpha ? StockDory::BoundUpper : bestScore >= beta ? StockDory::BoundLower : StockDory::BoundExact;
+                entry->Store(hash, bestLine[0], scoreToHash(bestScore, ply), depth, bound, abdadaTable->Generation());
+            }
 
-                if (depth == 0) {
-                    int score = evaluation.eval(chessBoard);
-                    return std::make_pair(std::array<Move, maxDepth>(), score);
+            if constexpr (Split::Parallel) {
+                //Cutoff
+                if (alpha >= beta) {
+                    return std::make_pair(bestLine, bestScore);
                 }
-                constexpr Color Ocolor = Opposite(color);
-#pragma omp parallel for schedule(dynamic)
-                for (uint8_t i = 0; i < moveList.Count(); i++) {;
-                    StockDory::Board localBoard = chessBoard;
-                    Move nextMove = moveList[i];
-                    Square from = nextMove.From();
-                    Square to = nextMove.To();
-                    Piece promotion = nextMove.Promotion();
-                    // Perform move
-                    PreviousState prevState = localBoard.Move<0>(from, to, promotion);
-                    std::pair<std::array<Move, maxDepth>, int> result = minimax<Ocolor, maxDepth>(localBoard, depth-1);
-                    // Update best score
-#pragma omp critical
-                    {
-                        if (bestScore < result.second) {
-                            bestScore = result.second;
-                            bestLine[0] = nextMove;
-                            bestLineSize = 1;
-                            for (int j = 0; j < depth - 1; j++) {
-                                bestLine[bestLineSize++] = result.first[j];
+                //Dynamic schedule since we do not know the ordering of moves or the number of moves in each call
+                //each thread keeps its own best child, the reduction merges them and alpha is published through an atomic
+                typename Trace::Scope split("split", depth);
+                std::atomic<int> sharedAlpha = alpha;
+                StockDory::BestChild<maxDepth> best;
+                typename Stats::Region region;
+                #pragma omp declare reduction(bestChild : StockDory::BestChild<maxDepth> : omp_out.Merge(omp_in))
+                #pragma omp parallel reduction(bestChild : best)
+                {
+                    region.Enter();
+                    //with make/unmake a thread joining the split copies the board once and makes/takes back every child on it,
+                    //a serialized (nested) region and copy-make (which never writes the parent) keep working on the caller's board
+                    std::optional<StockDory::Board> threadCopy;
+                    if (MakePolicy::MakesInPlace && omp_get_num_threads() > 1) {
+                        threadCopy.emplace(chessBoard);
+                    }
+                    StockDory::Board &threadBoard = threadCopy ? *threadCopy : chessBoard;
+                    countSplit();
+                    uint64_t finished = now();
+                    #pragma omp for schedule(dynamic)
+                    for (uint8_t i = sequentialCount; i < moveList.Count(); i++) {
+                        int localAlpha = sharedAlpha.load(std::memory_order_relaxed);
+                        if (localAlpha >= beta) {
+                            Stats::Add(StockDory::StatAborts);
+                            continue; // Mimic cutoff because you cannot break in
+                        }
+                        if (seePrune<color>(threadBoard, moveList, i, depth, ply, inCheck)) {
+                            continue;
+                        }
+                        Move nextMove = moveList[i];
+                        Square from = nextMove.From();
+                        Square to = nextMove.To();
+                        typename Trace::Scope subtree("subtree", depth - 1);
+                        typename MakePolicy::Child child = make<youngerMakeType>(threadBoard, ply, from, to, nextMove.Promotion());
+                        if constexpr (Split::Younger::Table) {
+                            abdadaTable->Prefetch(child.Position.Zobrist());
+                        }
+                        std::pair<std::array<Move, maxDepth>, int> localResult = search<typename Split::Younger, Ocolor, maxDepth>(child.Position, -beta, -localAlpha, depth - 1, ply + 1, extensions);
+                        localResult.second = -localResult.second;
+                        undo<youngerMakeType>(threadBoard, child, from, to);
+                        best.Update(i, nextMove, localResult.second, localResult.second > localAlpha, localResult.first, depth);
+                        {
+                            typename Trace::Scope critical("publish alpha");
+                            if (StockDory::AtomicMax(sharedAlpha, localResult.second)) {
+                                Stats::Add(StockDory::StatCriticalSections);
                             }
                         }
+                        finished = now();
                     }
-                    // Undo move
-                    localBoard.UndoMove<0>(prevState, from, to);
+                    //from the last move this thread searched to the end of the loop it waits for the others
+                    region.Leave(finished);
+                    if (Trace::Active()) {
+                        Trace::Record("barrier", finished, now(), depth);
+                    }
+                }
+                region.Close();
+                if (best.Score > bestScore) {
+                    bestScore = best.Score;
+                    bestLine = best.Line;
+                }
+                if (bestScore >= beta) {
+                    cutoff(best.Index == 0);
                 }
             }
-            // Black's turn
-            else {
-                bestScore = 50000;
-                const StockDory::SimplifiedMoveList<Black> moveList(chessBoard);
 
-                // Add check for no legal moves
-                if (moveList.Count() == 0 and chessBoard.Checked<color>()) {
-                    return std::make_pair(std::array<Move, maxDepth>(), mateScore+depth);
+            return std::make_pair(bestLine, bestScore);
+        }
+
+        //DTS node entry for one explicit stack frame, returns true when the node is a leaf and its score is already in BestScore
+        template<Color color, int maxDepth>
+        bool dtsEnter(StockDory::Board &chessBoard, StockDory::DTSFrame<maxDepth> &frame) {
+            Stats::Add(StockDory::StatNodes);
+            //mate distance pruning: no line from here can beat a mate already found closer to the root
+            frame.Alpha = std::max(frame.Alpha, -mateScore + frame.Ply);
+            frame.Beta = std::min(frame.Beta, mateScore - frame.Ply - 1);
+            if (frame.Alpha >= frame.Beta) {
+                frame.BestScore = frame.Alpha;
+                return true;
+            }
+            const AttackContext attacks = chessBoard.Attacks<color>();
+            const bool inCheck = attacks.InCheck();
+            //check extension: keep searching forcing lines instead of stopping while in check
+            if (inCheck && frame.Extensions < maxCheckExtensions && frame.Depth < maxDepth) {
+                frame.Depth++;
+                frame.Extensions++;
+            }
+            if (frame.Depth == 0) {
+                //mate or stalemate at the horizon only needs to know whether any legal move exists
+                if (!StockDory::HasLegalMove<color>(chessBoard, attacks)) {
+                    frame.BestScore = inCheck ? -mateScore + frame.Ply : 0;
+                    return true;
                 }
-                else if (moveList.Count() == 0) {
-                    // No legal moves
-                    int score = evaluation.eval(chessBoard);
-                    return std::make_pair(std::array<Move, maxDepth>(), 0);
+                frame.BestScore = quiescence<color>(chessBoard, frame.Alpha, frame.Beta, frame.Ply);
+                return true;
+            }
+            const StockDory::SimplifiedMoveList<color> legalMoves(chessBoard, attacks);
+            //mate or stalemate
+            if (legalMoves.Count() == 0) {
+                frame.BestScore = inCheck ? -mateScore + frame.Ply : 0;
+                return true;
+            }
+            //winning captures first, losing captures last, pruned captures never reach the frame
+            const StockDory::OrderedMoveList<color> moveList(chessBoard, legalMoves);
+            for (uint8_t i = 0; i < moveList.Count(); i++) {
+                if (!seePrune<color>(chessBoard, moveList, i, frame.Depth, frame.Ply, inCheck)) {
+                    frame.Moves[frame.Count++] = moveList[i];
                 }
+            }
+            return false;
+        }
 
-                if (depth == 0) {
-                    int score = evaluation.eval(chessBoard);
-                    return std::make_pair(std::array<Move, maxDepth>(), score);
+        template<int maxDepth>
+        bool dtsEnter(StockDory::Board &chessBoard, StockDory::DTSFrame<maxDepth> &frame) {
+            if (chessBoard.ColorToMove() == White) {
+                return dtsEnter<White, maxDepth>(chessBoard, frame);
+            }
+            return dtsEnter<Black, maxDepth>(chessBoard, frame);
+        }
+
+        //fold a child score into the frame, or into its split point once the frame has been shared
+        template<int maxDepth>
+        void dtsUpdate(StockDory::DTSFrame<maxDepth> &frame, Move move, const std::array<Move, maxDepth> &childLine, int score) {
+            if (frame.Split != nullptr) {
+                dtsUpdate<maxDepth>(*frame.Split, move, childLine, score);
+                return;
+            }
+            if (score > frame.BestScore) {
+                frame.BestScore = score;
+                frame.BestLine[0] = move;
+                for (int j = 0; j < frame.Depth - 1; j++) {
+                    frame.BestLine[j + 1] = childLine[j];
                 }
-                constexpr Color Ocolor = Opposite(color);
-#pragma omp parallel for schedule(dynamic)
-                for (uint8_t i = 0; i < moveList.Count(); i++) {
-                    StockDory::Board localBoard = chessBoard;
-                    Move nextMove = moveList[i];
-                    Square from = nextMove.From();
-                    Square to = nextMove.To();
-                    Piece promotion = nextMove.Promotion();
-                    // Perform move
-                    PreviousState prevState = localBoard.Move<0>(from, to, promotion);
-                    std::pair<std::array<Move, maxDepth>, int> result = minimax<Ocolor, maxDepth>(localBoard, depth-1);
-                    // Update best score
-                    #pragma omp critical
-                    {
-                        if (bestScore > result.second) {
-                            bestScore = result.second;
-                            bestLine[0] = nextMove;
-                            bestLineSize = 1;
-                            for (int j = 0; j < depth - 1; j++) {
-                                bestLine[bestLineSize++] = result.first[j];
-                            }
-                        }
-                    }
-                    // Undo move
-                    localBoard.UndoMove<0>(prevState, from, to);
+                frame.Alpha = std::max(frame.Alpha, score);
+                if (frame.Alpha >= frame.Beta) {
+                    cutoff(frame.Next == 1);
                 }
             }
-
-            return std::make_pair(bestLine, bestScore);
         }
 
-        std::pair<Move, int> alphaBeta(StockDory::Board &chessBoard, int alpha, int beta, int depth) {
-            //local variable of best move and best score
-            Move bestMove;
-            int bestScore;
+        template<int maxDepth>
+        void dtsUpdate(StockDory::DTSSplitPoint<maxDepth> &sp, Move move, const std::array<Move, maxDepth> &childLine, int score) {
+            typename Stats::Lock guard(sp.Lock);
+            if (sp.Cutoff || score <= sp.BestScore) {
+                return;
+            }
+            sp.BestScore = score;
+            sp.BestLine[0] = move;
+            for (int j = 0; j < sp.Depth - 1; j++) {
+                sp.BestLine[j + 1] = childLine[j];
+            }
+            sp.Alpha = std::max(sp.Alpha, score);
+            if (sp.Alpha >= sp.Beta) {
+                sp.Cutoff = true;
+                //a frame is only shared after its eldest brother
+                cutoff(false);
+            }
+        }
 
-            //base-case -> when depth is 0, we evaluate the position score and return a default move (which will be overrided in the parent call)
-            if (depth == 0) {
-                int score = evaluation.eval(chessBoard);
-                return std::make_pair(Move(), score);
+        //next move to search at a frame together with the window it is searched with
+        template<int maxDepth>
+        bool dtsNext(StockDory::DTSFrame<maxDepth> &frame, Move &move, int &alpha, int &beta) {
+            if (frame.Split != nullptr) {
+                StockDory::DTSSplitPoint<maxDepth> &sp = *frame.Split;
+                typename Stats::Lock guard(sp.Lock);
+                if (sp.Cutoff || sp.Next >= sp.Count) {
+                    return false;
+                }
+                move = sp.Moves[sp.Next++];
+                alpha = sp.Alpha;
+                beta = sp.Beta;
+                return true;
             }
-            //Minimax on white turn -> try to score as high as possible
-            else if (chessBoard.ColorToMove() == White) {
-                //set best score to negative infinity at start
-                bestScore = -50000;
-                //create move list for white
-                const StockDory::SimplifiedMoveList<White> moveList(chessBoard);
-                //iterate through the moves and calculate the best score that can be reached from the next position
-                for (uint8_t i = 0; i < moveList.Count(); i++) {
-                    Move nextMove = moveList[i];
-                    Square from = nextMove.From();
-                    Square to = nextMove.To();
-                    //Perform move
-                    PreviousState prevState = chessBoard.Move<0>(from, to);
-                    std::pair<Move, int> result = alphaBeta(chessBoard, alpha, beta, depth-1);
-                    //update if we found a better move for white
-                    if (bestScore < result.second) {
-                        bestScore = result.second;
-                        bestMove = nextMove;
+            if (frame.Alpha >= frame.Beta || frame.Next >= frame.Count) {
+                return false;
+            }
+            move = frame.Moves[frame.Next++];
+            alpha = frame.Alpha;
+            beta = frame.Beta;
+            return true;
+        }
+
+        //an idle thread (or a master waiting on its helpers) joins the split point with the most work left and searches its moves
+        template<int maxDepth>
+        bool dtsHelp(StockDory::DTSShared<maxDepth> &shared, StockDory::DTSThread<maxDepth> &thread, int base, StockDory::DTSSplitPoint<maxDepth> *ancestor, bool advertised) {
+            StockDory::DTSSplitPoint<maxDepth> *best = nullptr;
+            for (StockDory::DTSThread<maxDepth> *other : shared.Threads) {
+                for (StockDory::DTSSplitPoint<maxDepth> &sp : other->SplitPoints) {
+                    if (!sp.Active.load(std::memory_order_acquire) || sp.Next >= sp.Count || sp.Aborted()) {
+                        continue;
                     }
-                    //Undo move
-                    chessBoard.UndoMove<0>(prevState, from, to);
-                    //alpha check
-                    alpha = std::max(alpha, result.second);
-                    if (beta <= alpha) {
-                        break;
+                    //a master may only help below its own split point, otherwise it could be stuck when its helpers finish
+                    if (ancestor != nullptr && !sp.DescendsFrom(ancestor)) {
+                        continue;
+                    }
+                    if (best == nullptr || sp.Ply < best->Ply) {
+                        best = &sp;
                     }
-
                 }
             }
-            //Minimax on black turn -> try to score as low as possible
-            else {
-                //set best score to positive infinity
-                bestScore = 50000;
-                //calculate possible moves for black
-                const StockDory::SimplifiedMoveList<Black> moveList(chessBoard);
-                //repeat the same thing as white but for black instead
-                for (uint8_t i = 0; i < moveList.Count(); i++) {
-                    Move nextMove = moveList[i];
-                    Square from = nextMove.From();
-                    Square to = nextMove.To();
-                    Piece promotion = nextMove.Promotion();
-                    //Perform move
-                    PreviousState prevState = chessBoard.Move<0>(from, to, promotion);
-                    std::pair<Move, int> result = alphaBeta(chessBoard, alpha, beta, depth-1);
-                    if (bestScore > result.second) {
-                        bestScore = result.second;
-                        bestMove = nextMove;
-                    }
-                    //Undo move
-                    chessBoard.UndoMove<0>(prevState, from, to);
-                    //beta check
-                    beta = std::min(beta, result.second);
-                    if (beta <= alpha) {
+            if (best == nullptr) {
+                return false;
+            }
+            {
+                typename Stats::Lock guard(best->Lock);
+                //the slot may have been closed or reused since the scan
+                if (!best->Active || best->Cutoff || best->Next >= best->Count || (ancestor != nullptr && !best->DescendsFrom(ancestor))) {
+                    return false;
+                }
+                best->Helpers++;
+            }
+            if (advertised) {
+                shared.Idle--;
+            }
+            StockDory::DTSSplitPoint<maxDepth> &sp = *best;
+            StockDory::Board board = sp.Position;
+            while (true) {
+                Move move;
+                int alpha, beta;
+                {
+                    typename Stats::Lock guard(sp.Lock);
+                    if (sp.Cutoff || sp.Next >= sp.Count) {
                         break;
                     }
+                    move = sp.Moves[sp.Next++];
+                    alpha = sp.Alpha;
+                    beta = sp.Beta;
+                }
+                PreviousState prevState = board.Move<0>(move.From(), move.To(), move.Promotion());
+                thread.Frames[base].Reset(-beta, -alpha, sp.Depth - 1, sp.Ply + 1, sp.Extensions);
+                bool aborted;
+                int score = -dtsSearch<maxDepth>(shared, thread, board, base, &sp, aborted);
+                board.UndoMove<0>(prevState, move.From(), move.To());
+                if (aborted) {
+                    break;
                 }
+                dtsUpdate<maxDepth>(sp, move, thread.Frames[base].BestLine, score);
             }
-            return std::make_pair(bestMove, bestScore);
+            if (advertised) {
+                shared.Idle++;
+            }
+            sp.Helpers--;
+            return true;
         }
 
-        template<Color color, int maxDepth>
-        std::pair<std::array<Move, maxDepth>, int> alphaBetaNegaMoveCounter(StockDory::Board &chessBoard, int alpha, int beta, int depth, int &count) {
-             //local variable of best line and best score
-             int bestScore;
-             std::array<Move, maxDepth> bestLine;
-             int bestLineSize;
-             //create move list for player
-             const StockDory::SimplifiedMoveList<color> moveList(chessBoard);
-             //check for mate
-             if (moveList.Count() == 0 and chessBoard.Checked<color>()) {
-                 return std::make_pair(std::array<Move, maxDepth>(), -mateScore-depth);
-             }
-             //stalemate
-             else if (moveList.Count() == 0){
-                 return std::make_pair(std::array<Move, maxDepth>(), 0);
-             }
-             //base-case -> when depth is 0, we evaluate the position score and return a default move (which will be overrided in the parent call)
-             if (depth == 0) {
-                 int score = evaluation.eval(chessBoard);
-                 //flip the score for black since we are maximizing
-                 if (color == Black) {
-                     score *= -1;
-                 }
-                 return std::make_pair(std::array<Move, maxDepth>(), score);
-             }
-             constexpr enum Color Ocolor = Opposite(color);
-             //Assume from one perspective they are always the maximizer
-             //Set best score to negative infinity at start
-             bestScore = -50000;
-             //iterate through the moves and calculate the best score that can be reached from the next position
-             for (uint8_t i = 0; i < moveList.Count(); i++) {
-                 count++;
-                 Move nextMove = moveList[i];
-                 Square from = nextMove.From();
-                 Square to = nextMove.To();
-                 Piece promotion = nextMove.Promotion();
-                 //Perform move
-                 PreviousState prevState = chessBoard.Move<0>(from, to, promotion);
-                 std::pair<std::array<Move, maxDepth>, int> result = alphaBetaNegaMoveCounter<Ocolor, maxDepth>(chessBoard, -beta, -alpha, depth-1, count);
-                 //update if we found a better move for white
-                 result.second = -result.second;
-                 if (bestScore < result.second) {
-                     //create chess line with the current move as the head
-                     bestLine[0] = nextMove;
-                     //append result line to the current move
-                     bestLineSize = 1;
-                     for (int j = 0; j < depth - 1; j++) {
-                         bestLine[bestLineSize++] = result.first[j];
-                     }
-                     bestScore = result.second;
-                 }
-                 //Undo move
-                 chessBoard.UndoMove<0>(prevState, from, to);
-                 //alpha check
-                 alpha = std::max(alpha, result.second);
-                 if (beta <= alpha) {
-                     break;
-                 }
-             }
-
-             return std::make_pair(bestLine, bestScore);
-         }
-
-        template<Color color, int maxDepth>
-        std::pair<std::array<Move, maxDepth>, int> alphaBetaNega(StockDory::Board &chessBoard, int alpha, int beta, int depth) {
-             //local variable of best line and best score
-             int bestScore;
-             std::array<Move, maxDepth> bestLine;
-             int bestLineSize;
-             //create move list for player
-             const StockDory::SimplifiedMoveList<color> moveList(chessBoard);
-             //check for mate
-             if (moveList.Count() == 0 and chessBoard.Checked<color>()) {
-                 return std::make_pair(std::array<Move, maxDepth>(), -mateScore-depth);
-             }
-             //stalemate
-             else if (moveList.Count() == 0){
-                 return std::make_pair(std::array<Move, maxDepth>(), 0);
-             }
-             //base-case -> when depth is 0, we evaluate the position score and return a default move (which will be overrided in the parent call)
-             if (depth == 0) {
-                 int score = evaluation.eval(chessBoard);
-                 //flip the score for black since we are maximizing
-                 if (color == Black) {
-                     score *= -1;
-                 }
-                 return std::make_pair(std::array<Move, maxDepth>(), score);
-             }
-             constexpr enum Color Ocolor = Opposite(color);
-             //Assume from one perspective they are always the maximizer
-             //Set best score to negative infinity at start
-             bestScore = -50000;
-             //iterate through the moves and calculate the best score that can be reached from the next position
-             for (uint8_t i = 0; i < moveList.Count(); i++) {
-                 Move nextMove = moveList[i];
-                 Square from = nextMove.From();
-                 Square to = nextMove.To();
-                 Piece promotion = nextMove.Promotion();
-                 //Perform move
-                 PreviousState prevState = chessBoard.Move<0>(from, to, promotion);
-                 std::pair<std::array<Move, maxDepth>, int> result = alphaBetaNega<Ocolor, maxDepth>(chessBoard, -beta, -alpha, depth-1);
-                 //update if we found a better move for white
-                 result.second = -result.second;
-                 if (bestScore < result.second) {
-                     //create chess line with the current move as the head
-                     bestLine[0] = nextMove;
-                     //append result line to the current move
-                     bestLineSize = 1;
-                     for (int j = 0; j < depth - 1; j++) {
-                         bestLine[bestLineSize++] = result.first[j];
-                     }
-                     bestScore = result.second;
-                 }
-                 //Undo move
-                 chessBoard.UndoMove<0>(prevState, from, to);
-                 //alpha check
-                 alpha = std::max(alpha, result.second);
-                 if (beta <= alpha) {
-                     break;
-                 }
-             }
-
-             return std::make_pair(bestLine, bestScore);
-         }
-    
-        template<Color color, int maxDepth>
-        std::pair<std::array<Move, maxDepth>, int> naiveParallelAlphaBeta(const StockDory::Board &chessBoard, int alpha, int beta, int depth) {
-            std::array<Move, maxDepth> bestLine;
-            int bestScore = -50000;
-            // create move list for player
-            const StockDory::SimplifiedMoveList<color> moveList(chessBoard);
-             //check for mate
-            if (moveList.Count() == 0 and chessBoard.Checked<color>()) {
-                return std::make_pair(std::array<Move, maxDepth>(), -mateScore-depth);
-            }
-            //stalemate
-            else if (moveList.Count() == 0){
-                return std::make_pair(std::array<Move, maxDepth>(), 0);
+        //close a frame's split point: wait for (and help) the helpers, then take the shared result back into the frame
+        template<int maxDepth>
+        void dtsJoin(StockDory::DTSShared<maxDepth> &shared, StockDory::DTSThread<maxDepth> &thread, int index) {
+            StockDory::DTSFrame<maxDepth> &frame = thread.Frames[index];
+            StockDory::DTSSplitPoint<maxDepth> &sp = *frame.Split;
+            //helpful master: rather than wait, search for the threads still working under this split point
+            while (sp.Helpers > 0) {
+                const uint64_t looked = Stats::Now();
+                if (!dtsHelp<maxDepth>(shared, thread, index + 1, &sp, false)) {
+                    std::this_thread::yield();
+                    Stats::Add(StockDory::StatSyncNanoseconds, Stats::Now() - looked);
+                }
             }
-            if (depth == 0) {
-                int score = evaluation.eval(chessBoard);
-                if (color == Black) {
-                    score *= -1;
+            typename Stats::Lock guard(sp.Lock);
+            frame.BestScore = sp.BestScore;
+            frame.BestLine = sp.BestLine;
+            frame.Alpha = sp.Alpha;
+            sp.Active.store(false, std::memory_order_release);
+            frame.Split = nullptr;
+        }
+
+        //publish the shallowest frame of this thread's stack that has searched its eldest brother and still has moves left
+        template<int maxDepth>
+        void dtsSplit(StockDory::DTSThread<maxDepth> &thread, const StockDory::Board &chessBoard, int base, int top, StockDory::DTSSplitPoint<maxDepth> *joined) {
+            for (int k = base; k < top; k++) {
+                StockDory::DTSFrame<maxDepth> &frame = thread.Frames[k];
+                if (frame.Split != nullptr || frame.Depth < dtsSplitDepth || frame.Next < 2 || frame.Next >= frame.Count || frame.Alpha >= frame.Beta) {
+                    continue;
+                }
+                StockDory::DTSSplitPoint<maxDepth> &sp = thread.SplitPoints[k];
+                typename Stats::Lock guard(sp.Lock);
+                //the frame's position is rebuilt from the current one by taking back the moves above it
+                StockDory::Board &position = sp.Position;
+                position = chessBoard;
+                for (int m = top - 1; m >= k; m--) {
+                    position.UndoMove<0>(thread.Frames[m].Previous, thread.Frames[m].Current.From(), thread.Frames[m].Current.To());
+                }
+                sp.Moves = frame.Moves;
+                sp.Count = frame.Count;
+                sp.Next = frame.Next;
+                sp.Alpha = frame.Alpha;
+                sp.Beta = frame.Beta;
+                sp.Depth = frame.Depth;
+                sp.Ply = frame.Ply;
+                sp.Extensions = frame.Extensions;
+                sp.BestScore = frame.BestScore;
+                sp.BestLine = frame.BestLine;
+                sp.Helpers = 0;
+                sp.Cutoff = false;
+                sp.Parent = joined;
+                for (int m = k - 1; m >= base; m--) {
+                    if (thread.Frames[m].Split != nullptr) {
+                        sp.Parent = thread.Frames[m].Split;
+                        break;
+                    }
                 }
-                return std::make_pair(std::array<Move, maxDepth>(), score);
+                frame.Split = &sp;
+                sp.Active.store(true, std::memory_order_release);
+                Stats::Add(StockDory::StatSplits);
+                return;
             }
+        }
 
-            constexpr enum Color Ocolor = Opposite(color);
+        //take back the moves above frame index, closing any split points on the way, so the search resumes at that frame
+        template<int maxDepth>
+        void dtsUnwind(StockDory::DTSShared<maxDepth> &shared, StockDory::DTSThread<maxDepth> &thread, StockDory::Board &chessBoard, int index, int top) {
+            for (int k = top; k > index; k--) {
+                if (thread.Frames[k].Split != nullptr) {
+                    thread.Frames[k].Split->Cutoff = true;
+                    dtsJoin(shared, thread, k);
+                }
+                StockDory::DTSFrame<maxDepth> &parent = thread.Frames[k - 1];
+                chessBoard.UndoMove<0>(parent.Previous, parent.Current.From(), parent.Current.To());
+            }
+        }
 
-            //Dynamic schedule since we do not know the ordering of moves or the number of moves in each call
-            #pragma omp parallel for shared(alpha, beta) schedule(dynamic)
-            for (uint8_t i = 0; i < moveList.Count(); i++) {
-                // int thread = omp_get_thread_num();
-                // // printf("%d\n", thread);
-                // printf("I hit the for loop for thread %d \n", thread);
-                if (alpha >= beta) {
-                    continue; // Mimic cutoff because you cannot break in
+        //iterative alpha-beta over the thread's explicit stack starting at frame base (already Reset by the caller)
+        template<int maxDepth>
+        int dtsSearch(StockDory::DTSShared<maxDepth> &shared, StockDory::DTSThread<maxDepth> &thread, StockDory::Board &chessBoard, int base, StockDory::DTSSplitPoint<maxDepth> *joined, bool &aborted) {
+            aborted = false;
+            int top = base;
+            bool finished = dtsEnter(chessBoard, thread.Frames[top]);
+            while (true) {
+                if (finished) {
+                    if (top == base) {
+                        return thread.Frames[base].BestScore;
+                    }
+                    StockDory::DTSFrame<maxDepth> &child = thread.Frames[top--];
+                    StockDory::DTSFrame<maxDepth> &frame = thread.Frames[top];
+                    chessBoard.UndoMove<0>(frame.Previous, frame.Current.From(), frame.Current.To());
+                    dtsUpdate<maxDepth>(frame, frame.Current, child.BestLine, -child.BestScore);
+                    finished = false;
                 }
-                //Private copy of the board for each thread
-                StockDory::Board threadBoard = chessBoard;
-                Move nextMove = moveList[i];
-                Square from = nextMove.From();
-                Square to = nextMove.To();
-                Piece promotion = nextMove.Promotion();
-                PreviousState prevState = threadBoard.Move<0>(from, to, promotion);
-                std::pair<std::array<Move, maxDepth>, int> localResult = alphaBetaNega<Ocolor, maxDepth>(threadBoard, -beta, -alpha, depth - 1);
-                localResult.second = -localResult.second;
-                threadBoard.UndoMove<0>(prevState, from, to);
-                #pragma omp critical
-                {
-                    if (localResult.second > bestScore) {
-                        bestScore = localResult.second;
-                        bestLine[0] = nextMove;
-                        for (int j = 0; j < depth - 1; j++) {
-                            bestLine[j + 1] = localResult.first[j];
-                        }
-                        alpha = std::max(alpha, bestScore);
+                //a cutoff in the split point we are helping makes the whole subtree useless
+                if (joined != nullptr && joined->Aborted()) {
+                    if (thread.Frames[base].Split != nullptr) {
+                        thread.Frames[base].Split->Cutoff = true;
+                        dtsJoin(shared, thread, base);
                     }
+                    dtsUnwind(shared, thread, chessBoard, base, top);
+                    Stats::Add(StockDory::StatAborts);
+                    aborted = true;
+                    return 0;
+                }
+                //a helper cut off one of our own split points, drop everything searched below it
+                for (int k = base; k < top; k++) {
+                    if (thread.Frames[k].Split != nullptr && thread.Frames[k].Split->Cutoff) {
+                        dtsUnwind(shared, thread, chessBoard, k, top);
+                        Stats::Add(StockDory::StatAborts);
+                        top = k;
+                        break;
+                    }
+                }
+                StockDory::DTSFrame<maxDepth> &frame = thread.Frames[top];
+                Move move;
+                int alpha, beta;
+                if (!dtsNext(frame, move, alpha, beta)) {
+                    if (frame.Split != nullptr) {
+                        dtsJoin(shared, thread, top);
+                    }
+                    finished = true;
+                    continue;
+                }
+                frame.Current = move;
+                frame.Previous = chessBoard.Move<0>(move.From(), move.To(), move.Promotion());
+                thread.Frames[top + 1].Reset(-beta, -alpha, frame.Depth - 1, frame.Ply + 1, frame.Extensions);
+                top++;
+                finished = dtsEnter(chessBoard, thread.Frames[top]);
+                if (!finished && shared.Idle > 0) {
+                    dtsSplit(thread, chessBoard, base, top, joined);
                 }
             }
-
-            return std::make_pair(bestLine, bestScore);
         }
 
         template<Color color, int maxDepth>
-        std::pair<std::array<Move, maxDepth>, int> naiveParallelPVAlphaBeta(const StockDory::Board &chessBoard, int alpha, int beta, int depth) {
+        std::pair<std::array<Move, maxDepth>, int> ybwcTask(StockDory::Board &chessBoard, int alpha, int beta, int depth, int ply, int extensions) {
+            //not enough work left to pay for tasks
+            if (depth < taskSequentialDepth) {
+                return alphaBetaNega<color, maxDepth>(chessBoard, alpha, beta, depth, ply, extensions);
+            }
+            Stats::Add(StockDory::StatNodes);
             std::array<Move, maxDepth> bestLine;
             int bestScore = -50000;
+            //mate distance pruning: no line from here can beat a mate already found closer to the root
+            alpha = std::max(alpha, -mateScore + ply);
+            beta = std::min(beta, mateScore - ply - 1);
+            if (alpha >= beta) {
+                return std::make_pair(std::array<Move, maxDepth>(), alpha);
+            }
             // create move list for player
-            const StockDory::SimplifiedMoveList<color> moveList(chessBoard);
-             //check for mate
-            if (moveList.Count() == 0 and chessBoard.Checked<color>()) {
-                return std::make_pair(std::array<Move, maxDepth>(), -mateScore-depth);
+            const AttackContext attacks = chessBoard.Attacks<color>();
+            const StockDory::SimplifiedMoveList<color> legalMoves(chessBoard, attacks);
+            const bool inCheck = attacks.InCheck();
+            //check for mate
+            if (legalMoves.Count() == 0 and inCheck) {
+                return std::make_pair(std::array<Move, maxDepth>(), -mateScore + ply);
             }
             //stalemate
-            else if (moveList.Count() == 0){
+            else if (legalMoves.Count() == 0){
                 return std::make_pair(std::array<Move, maxDepth>(), 0);
             }
-            if (depth == 0) {
-                int score = evaluation.eval(chessBoard);
-                if (color == Black) {
-                    score *= -1;
-                }
-                return std::make_pair(std::array<Move, maxDepth>(), score);
+            //check extension: keep searching forcing lines instead of stopping while in check
+            if (inCheck && extensions < maxCheckExtensions && depth < maxDepth) {
+                depth++;
+                extensions++;
             }
+            //winning captures first, losing captures last
+            StockDory::OrderedMoveList<color> moveList(chessBoard, legalMoves);
+            iidOrder<color, maxDepth>(chessBoard, moveList, alpha, beta, depth, ply, extensions);
 
             constexpr enum Color Ocolor = Opposite(color);
 
-            // Process the leftmost child sequentially
+            // Process the eldest brother in this task, on this board
             Move PV = moveList[0];
             Square from = PV.From();
             Square to = PV.To();
-            Piece promotion = PV.Promotion();
-            //create local copy for safety
-            StockDory::Board boardCopy = chessBoard;
-            PreviousState prevState = boardCopy.Move<0>(from, to, promotion);
-            std::pair<std::array<Move, maxDepth>, int> result = naiveParallelPVAlphaBeta<Ocolor, maxDepth>(boardCopy, -beta, -alpha, depth - 1);
-            result.second = -result.second;
-            boardCopy.UndoMove<0>(prevState, from, to);
-            if (result.second > bestScore) {
-                bestScore = result.second;
-                bestLine[0] = PV;
-                //Store best line
-                for (int j = 0; j < depth - 1; j++) {
-                    bestLine[j + 1] = result.first[j];
-                }
-                alpha = std::max(alpha, bestScore);
+            PreviousState prevState = chessBoard.Move<0>(from, to, PV.Promotion());
+            std::pair<std::array<Move, maxDepth>, int> result = ybwcTask<Ocolor, maxDepth>(chessBoard, -beta, -alpha, depth - 1, ply + 1, extensions);
+            chessBoard.UndoMove<0>(prevState, from, to);
+            bestScore = -result.second;
+            bestLine[0] = PV;
+            for (int j = 0; j < depth - 1; j++) {
+                bestLine[j + 1] = result.first[j];
             }
+            alpha = std::max(alpha, bestScore);
             //Cutoff
             if (alpha >= beta) {
+                cutoff(true);
                 return std::make_pair(bestLine, bestScore);
             }
-            //Dynamic schedule since we do not know the ordering of moves or the number of moves in each call
-            #pragma omp parallel for shared(alpha, beta) schedule(dynamic)
-            for (uint8_t i = 1; i < moveList.Count(); i++) {
-                // int thread = omp_get_thread_num();
-                // // printf("%d\n", thread);
-                // printf("I hit the for loop for thread %d \n", thread);
-                // printf("Thread ID: %lu\n", (unsigned long)pthread_self());
-                if (alpha >= beta) {
-                    continue; // Mimic cutoff because you cannot break in
+            //tasks publish (score, index) through one packed word and alpha through an atomic, each child keeps its own line
+            StockDory::AtomicBest best(bestScore, 0);
+            std::atomic<int> sharedAlpha = alpha;
+            std::vector<std::array<Move, maxDepth>> lines(moveList.Count());
+            if constexpr (Stats::Enabled) {
+                if (omp_get_num_threads() > 1) {
+                    Stats::Add(StockDory::StatSplits);
                 }
-                //Private copy of the board for each thread
-                StockDory::Board threadBoard = chessBoard;
-                Move nextMove = moveList[i];
-                Square from = nextMove.From();
-                Square to = nextMove.To();
-                Piece promotion = nextMove.Promotion();
-                PreviousState prevState = threadBoard.Move<0>(from, to, promotion);
-                std::pair<std::array<Move, maxDepth>, int> localResult = alphaBetaNega<Ocolor, maxDepth>(threadBoard, -beta, -alpha, depth - 1);
-                localResult.second = -localResult.second;
-                threadBoard.UndoMove<0>(prevState, from, to);
-                #pragma omp critical
-                {
-                    if (localResult.second > bestScore) {
-                        bestScore = localResult.second;
-                        bestLine[0] = nextMove;
-                        for (int j = 0; j < depth - 1; j++) {
-                            bestLine[j + 1] = localResult.first[j];
+            }
+            #pragma omp taskgroup
+            {
+                for (uint8_t i = 1; i < moveList.Count(); i++) {
+                    #pragma omp task firstprivate(i) shared(chessBoard, moveList, beta, best, sharedAlpha, lines)
+                    {
+                        #pragma omp cancellation point taskgroup
+                        typename Stats::Busy busy;
+                        int localAlpha = sharedAlpha.load(std::memory_order_relaxed);
+                        //checked by every task in case cancellation is disabled (OMP_CANCELLATION unset)
+                        if (localAlpha < beta) {
+                            //Private copy of the board for each task
+                            StockDory::Board taskBoard = chessBoard;
+                            if (!seePrune<color>(taskBoard, moveList, i, depth, ply, inCheck)) {
+                                Move nextMove = moveList[i];
+                                taskBoard.Move<0>(nextMove.From(), nextMove.To(), nextMove.Promotion());
+                                std::pair<std::array<Move, maxDepth>, int> localResult = ybwcTask<Ocolor, maxDepth>(taskBoard, -beta, -localAlpha, depth - 1, ply + 1, extensions);
+                                int score = -localResult.second;
+                                lines[i] = localResult.first;
+                                best.Offer(score, score > localAlpha, i);
+                                if (StockDory::AtomicMax(sharedAlpha, score)) {
+                                    Stats::Add(StockDory::StatCriticalSections);
+                                }
+                                if (score >= beta) {
+                                    #pragma omp cancel taskgroup
+                                }
+                            }
+                        }
+                        else {
+                            Stats::Add(StockDory::StatAborts);
                         }
-                        alpha = std::max(alpha, bestScore);
                     }
                 }
             }
+            if (best.Index() != 0) {
+                bestScore = best.Score();
+                bestLine[0] = moveList[best.Index()];
+                for (int j = 0; j < depth - 1; j++) {
+                    bestLine[j + 1] = lines[best.Index()][j];
+                }
+            }
+            if (bestScore >= beta) {
+                cutoff(false);
+            }
 
             return std::make_pair(bestLine, bestScore);
         }
 
+    public:
+        //minimax implementation
         template<Color color, int maxDepth>
-        std::pair<std::array<Move, maxDepth>, int> YBWC(const StockDory::Board &chessBoard, int alpha, int beta, int depth) {
+        std::pair<std::array<Move, maxDepth>, int> minimax(StockDory::Board &chessBoard, int depth) {
+            Stats::Add(StockDory::StatNodes);
             std::array<Move, maxDepth> bestLine;
-            int bestScore = -50000;
-            // create move list for player
-            const StockDory::SimplifiedMoveList<color> moveList(chessBoard);
-             //check for mate
-            if (moveList.Count() == 0 and chessBoard.Checked<color>()) {
-                return std::make_pair(std::array<Move, maxDepth>(), -mateScore-depth);
-            }
-            //stalemate
-            else if (moveList.Count() == 0){
-                return std::make_pair(std::array<Move, maxDepth>(), 0);
-            }
-            if (depth == 0) {
-                int score = evaluation.eval(chessBoard);
-                if (color == Black) {
-                    score *= -1;
+            int bestScore;
+            int bestLineSize;
+            // Base case
+
+            // White's turn
+            if (chessBoard.ColorToMove() == White) {
+                bestScore = -50000;
+                const AttackContext attacks = chessBoard.Attacks<White>();
+                if (depth == 0) {
+                    // A leaf only needs to know whether any legal move exists, not the moves themselves
+                    if (!StockDory::HasLegalMove<White>(chessBoard, attacks)) {
+                        return std::make_pair(std::array<Move, maxDepth>(), attacks.InCheck() ? -mateScore-depth : 0);
+                    }
+                    int score = evaluate(chessBoard);
+                    return std::make_pair(std::array<Move, maxDepth>(), score);
                 }
-                return std::make_pair(std::array<Move, maxDepth>(), score);
-            }
+                const StockDory::SimplifiedMoveList<White> moveList(chessBoard, attacks);
 
-            constexpr enum Color Ocolor = Opposite(color);
+                // Add check for no legal moves
+                if (moveList.Count() == 0 and attacks.InCheck()) {
+                    return std::make_pair(std::array<Move, maxDepth>(), -mateScore-depth);
+                }
+                else if (moveList.Count() == 0) {
+                    // No legal moves
+                    return std::make_pair(std::array<Move, maxDepth>(), 0);
+                }
+                constexpr Color Ocolor = Opposite(color);
 
-            // Process the leftmost child sequentially
-            Move PV = moveList[0];
-            Square from = PV.From();
-            Square to = PV.To();
-            Piece promotion = PV.Promotion();
-            //create local copy for safety
-            StockDory::Board boardCopy = chessBoard;
-            PreviousState prevState = boardCopy.Move<0>(from, to, promotion);
-            std::pair<std::array<Move, maxDepth>, int> result = YBWC<Ocolor, maxDepth>(boardCopy, -beta, -alpha, depth - 1);
-            result.second = -result.second;
-            boardCopy.UndoMove<0>(prevState, from, to);
-            if (result.second > bestScore) {
-                bestScore = result.second;
-                bestLine[0] = PV;
-                //Store best line
-                for (int j = 0; j < depth - 1; j++) {
-                    bestLine[j + 1] = result.first[j];
+                for (uint8_t i = 0; i < moveList.Count(); i++) {
+                    Move nextMove = moveList[i];
+                    Square from = nextMove.From();
+                    Square to = nextMove.To();
+                    Piece promotion = nextMove.Promotion();
+                    // Perform move
+                    PreviousState prevState = chessBoard.Move<0>(from, to, promotion);
+                    std::pair<std::array<Move, maxDepth>, int> result = minimax<Ocolor, maxDepth>(chessBoard, depth-1);
+                    // Update best score
+                    if (bestScore < result.second) {
+                        bestScore = result.second;
+                        bestLine[0] = nextMove;
+                        bestLineSize = 1;
+                        for (int j = 0; j < depth - 1; j++) {
+                            bestLine[bestLineSize++] = result.first[j];
+                        }
+                    }
+                    // Undo move
+                    chessBoard.UndoMove<0>(prevState, from, to);
                 }
-                alpha = std::max(alpha, bestScore);
             }
-            //Cutoff
-            if (alpha >= beta) {
-                return std::make_pair(bestLine, bestScore);
-            }
-            //Dynamic schedule since we do not know the ordering of moves or the number of moves in each call
-            #pragma omp parallel for shared(alpha, beta) schedule(dynamic)
-            for (uint8_t i = 1; i < moveList.Count(); i++) {
-                // int thread = omp_get_thread_num();
-                // // printf("%d\n", thread);
-                // printf("I hit the for loop for thread %d \n", thread);
-                // printf("Thread ID: %lu\n", (unsigned long)pthread_self());
-                if (alpha >= beta) {
-                    continue; // Mimic cutoff because you cannot break in
+            // Black's turn
+            else {
+                bestScore = 50000;
+                const AttackContext attacks = chessBoard.Attacks<Black>();
+                if (depth == 0) {
+                    // A leaf only needs to know whether any legal move exists, not the moves themselves
+                    if (!StockDory::HasLegalMove<Black>(chessBoard, attacks)) {
+                        return std::make_pair(std::array<Move, maxDepth>(), attacks.InCheck() ? mateScore+depth : 0);
+                    }
+                    int score = evaluate(chessBoard);
+                    return std::make_pair(std::array<Move, maxDepth>(), score);
                 }
-                //Private copy of the board for each thread
-                StockDory::Board threadBoard = chessBoard;
-                Move nextMove = moveList[i];
-                Square from = nextMove.From();
-                Square to = nextMove.To();
-                Piece promotion = nextMove.Promotion();
-                PreviousState prevState = threadBoard.Move<0>(from, to, promotion);
-                std::pair<std::array<Move, maxDepth>, int> localResult = YBWC<Ocolor, maxDepth>(threadBoard, -beta, -alpha, depth - 1);
-                localResult.second = -localResult.second;
-                threadBoard.UndoMove<0>(prevState, from, to);
-                #pragma omp critical
-                {
-                    if (localResult.second > bestScore) {
-                        bestScore = localResult.second;
+                const StockDory::SimplifiedMoveList<Black> moveList(chessBoard, attacks);
+
+                // Add check for no legal moves
+                if (moveList.Count() == 0 and attacks.InCheck()) {
+                    return std::make_pair(std::array<Move, maxDepth>(), mateScore+depth);
+                }
+                else if (moveList.Count() == 0) {
+                    // No legal moves
+                    return std::make_pair(std::array<Move, maxDepth>(), 0);
+                }
+                constexpr Color Ocolor = Opposite(color);
+
+                for (uint8_t i = 0; i < moveList.Count(); i++) {
+                    Move nextMove = moveList[i];
+                    Square from = nextMove.From();
+                    Square to = nextMove.To();
+                    Piece promotion = nextMove.Promotion();
+                    // Perform move
+                    PreviousState prevState = chessBoard.Move<0>(from, to, promotion);
+                    std::pair<std::array<Move, maxDepth>, int> result = minimax<Ocolor, maxDepth>(chessBoard, depth-1);
+                    // Update best score
+                    if (bestScore > result.second) {
+                        bestScore = result.second;
                         bestLine[0] = nextMove;
+                        bestLineSize = 1;
                         for (int j = 0; j < depth - 1; j++) {
-                            bestLine[j + 1] = localResult.first[j];
+                            bestLine[bestLineSize++] = result.first[j];
                         }
-                        alpha = std::max(alpha, bestScore);
                     }
+                    // Undo move
+                    chessBoard.UndoMove<0>(prevState, from, to);
                 }
             }
 
@@ -714,379 +942,355 @@ class Engine {
         }
 
         template<Color color, int maxDepth>
-        std::pair<std::array<Move, maxDepth>, int> PVS(const StockDory::Board &chessBoard, int alpha, int beta, int depth) {
+        std::pair<std::array<Move, maxDepth>, int> parallelMinimax(StockDory::Board &chessBoard, int depth) {
+            Stats::Add(StockDory::StatNodes);
+            // Local variables
             std::array<Move, maxDepth> bestLine;
-            int bestScore = -50000;
-            // create move list for player
-            const StockDory::SimplifiedMoveList<color> moveList(chessBoard);
-             //check for mate
-            if (moveList.Count() == 0 and chessBoard.Checked<color>()) {
-                return std::make_pair(std::array<Move, maxDepth>(), -mateScore-depth);
-            }
-            //stalemate
-            else if (moveList.Count() == 0){
-                return std::make_pair(std::array<Move, maxDepth>(), 0);
-            }
-            if (depth == 0) {
-                int score = evaluation.eval(chessBoard);
-                if (color == Black) {
-                    score *= -1;
-                }
-                return std::make_pair(std::array<Move, maxDepth>(), score);
-            }
+            int bestScore;
+            // Base case
 
-            constexpr enum Color Ocolor = Opposite(color);
+            // White's turn
+            if (chessBoard.ColorToMove() == White) {
+                bestScore = -50000;
+                const AttackContext attacks = chessBoard.Attacks<White>();
+                if (depth == 0) {
+                    // A leaf only needs to know whether any legal move exists, not the moves themselves
+                    if (!StockDory::HasLegalMove<White>(chessBoard, attacks)) {
+                        return std::make_pair(std::array<Move, maxDepth>(), attacks.InCheck() ? -mateScore-depth : 0);
+                    }
+                    int score = evaluate(chessBoard);
+                    return std::make_pair(std::array<Move, maxDepth>(), score);
+                }
+                const StockDory::SimplifiedMoveList<White> moveList(chessBoard, attacks);
 
-            // Process the leftmost child sequentially
-            Move PV = moveList[0];
-            Square from = PV.From();
-            Square to = PV.To();
-            Piece promotion = PV.Promotion();
-            //create local copy for safety
-            StockDory::Board boardCopy = chessBoard;
-            PreviousState prevState = boardCopy.Move<0>(from, to, promotion);
-            std::pair<std::array<Move, maxDepth>, int> result = PVS<Ocolor, maxDepth>(boardCopy, -beta, -alpha, depth - 1);
-            result.second = -result.second;
-            boardCopy.UndoMove<0>(prevState, from, to);
-            if (result.second > bestScore) {
-                bestScore = result.second;
-                bestLine[0] = PV;
-                //Store best line
-                for (int j = 0; j < depth - 1; j++) {
-                    bestLine[j + 1] = result.first[j];
+                // Add check for no legal moves
+                if (moveList.Count() == 0 and attacks.InCheck()) {
+                    return std::make_pair(std::array<Move, maxDepth>(), -mateScore-depth);
                 }
-                alpha = std::max(alpha, bestScore);
-            }
-            //Cutoff
-            if (alpha >= beta) {
-                return std::make_pair(bestLine, bestScore);
-            }
-            //Dynamic schedule since we do not know the ordering of moves or the number of moves in each call
-            #pragma omp parallel for shared(alpha, beta) schedule(dynamic)
-            for (uint8_t i = 1; i < moveList.Count(); i++) {
-                // int thread = omp_get_thread_num();
-                // // printf("%d\n", thread);
-                // printf("I hit the for loop for thread %d \n", thread);
-                if (alpha >= beta) {
-                    continue; // Mimic cutoff because you cannot break in
+                else if (moveList.Count() == 0) {
+                    // No legal moves
+                    return std::make_pair(std::array<Move, maxDepth>(), 0);
                 }
-                //Private copy of the board for each thread
-                StockDory::Board threadBoard = chessBoard;
-                Move nextMove = moveList[i];
-                Square from = nextMove.From();
-                Square to = nextMove.To();
-                Piece promotion = nextMove.Promotion();
-                PreviousState prevState = threadBoard.Move<0>(from, to, promotion);
-                std::pair<std::array<Move, maxDepth>, int> localResult = alphaBetaNegaParallel<Ocolor, maxDepth>(threadBoard, -beta, -alpha, depth - 1);
-                localResult.second = -localResult.second;
-                threadBoard.UndoMove<0>(prevState, from, to);
-                #pragma omp critical
+                constexpr Color Ocolor = Opposite(color);
+                //each thread keeps its own best child and the reduction merges them
+                StockDory::BestChild<maxDepth> best;
+                typename Trace::Scope split("split", depth);
+                typename Stats::Region region;
+#pragma omp declare reduction(bestChild : StockDory::BestChild<maxDepth> : omp_out.Merge(omp_in))
+#pragma omp parallel reduction(bestChild : best)
                 {
-                    if (localResult.second > bestScore) {
-                        bestScore = localResult.second;
-                        bestLine[0] = nextMove;
-                        for (int j = 0; j < depth - 1; j++) {
-                            bestLine[j + 1] = localResult.first[j];
-                        }
-                        alpha = std::max(alpha, bestScore);
+                    region.Enter();
+                    //a thread joining the split copies the board once and makes/takes back every child on it,
+                    //a serialized (nested) region keeps working on the caller's board
+                    std::optional<StockDory::Board> threadCopy;
+                    if (omp_get_num_threads() > 1) {
+                        threadCopy.emplace(chessBoard);
+                    }
+                    StockDory::Board &localBoard = threadCopy ? *threadCopy : chessBoard;
+                    countSplit();
+                    uint64_t finished = now();
+#pragma omp for schedule(dynamic)
+                    for (uint8_t i = 0; i < moveList.Count(); i++) {;
+                        Move nextMove = moveList[i];
+                        Square from = nextMove.From();
+                        Square to = nextMove.To();
+                        Piece promotion = nextMove.Promotion();
+                        typename Trace::Scope subtree("subtree", depth - 1);
+                        // Perform move
+                        PreviousState prevState = localBoard.Move<0>(from, to, promotion);
+                        std::pair<std::array<Move, maxDepth>, int> result = minimax<Ocolor, maxDepth>(localBoard, depth-1);
+                        // Update best score
+                        best.Update(i, nextMove, result.second, true, result.first, depth);
+                        // Undo move
+                        localBoard.UndoMove<0>(prevState, from, to);
+                        finished = now();
+                    }
+                    region.Leave(finished);
+                    if (Trace::Active()) {
+                        Trace::Record("barrier", finished, now(), depth);
                     }
                 }
+                region.Close();
+                bestScore = best.Score;
+                bestLine = best.Line;
             }
-
-            return std::make_pair(bestLine, bestScore);
-        }
-
-        template<Color color, int maxDepth>
-        std::pair<std::array<Move, maxDepth>, int> alphaBetaNegaParallel(const StockDory::Board &chessBoard, int alpha, int beta, int depth) {
-            std::array<Move, maxDepth> bestLine;
-            int bestScore = -50000;
-            // create move list for player
-            const StockDory::SimplifiedMoveList<color> moveList(chessBoard);
-             //check for mate
-            if (moveList.Count() == 0 and chessBoard.Checked<color>()) {
-                return std::make_pair(std::array<Move, maxDepth>(), -mateScore-depth);
-            }
-            //stalemate
-            else if (moveList.Count() == 0){
-                return std::make_pair(std::array<Move, maxDepth>(), 0);
-            }
-            if (depth == 0) {
-                int score = evaluation.eval(chessBoard);
-                if (color == Black) {
-                    score *= -1;
+            // Black's turn
+            else {
+                bestScore = 50000;
+                const AttackContext attacks = chessBoard.Attacks<Black>();
+                if (depth == 0) {
+                    // A leaf only needs to know whether any legal move exists, not the moves themselves
+                    if (!StockDory::HasLegalMove<Black>(chessBoard, attacks)) {
+                        return std::make_pair(std::array<Move, maxDepth>(), attacks.InCheck() ? mateScore+depth : 0);
+                    }
+                    int score = evaluate(chessBoard);
+                    return std::make_pair(std::array<Move, maxDepth>(), score);
                 }
-                return std::make_pair(std::array<Move, maxDepth>(), score);
-            }
+                const StockDory::SimplifiedMoveList<Black> moveList(chessBoard, attacks);
 
-            constexpr enum Color Ocolor = Opposite(color);
-            //Dynamic schedule since we do not know the ordering of moves or the number of moves in each call
-            #pragma omp parallel for shared(alpha, beta) schedule(dynamic)
-            for (uint8_t i = 0; i < moveList.Count(); i++) {
-                // int thread = omp_get_thread_num();
-                // // printf("%d\n", thread);
-                // printf("I hit the for loop for thread %d \n", thread);
-                if (alpha >= beta) {
-                    continue; // Mimic cutoff because you cannot break in
+                // Add check for no legal moves
+                if (moveList.Count() == 0 and attacks.InCheck()) {
+                    return std::make_pair(std::array<Move, maxDepth>(), mateScore+depth);
                 }
-                //Private copy of the board for each thread
-                StockDory::Board threadBoard = chessBoard;
-                Move nextMove = moveList[i];
-                Square from = nextMove.From();
-                Square to = nextMove.To();
-                Piece promotion = nextMove.Promotion();
-                PreviousState prevState = threadBoard.Move<0>(from, to, promotion);
-                std::pair<std::array<Move, maxDepth>, int> localResult = alphaBetaNegaParallel<Ocolor, maxDepth>(threadBoard, -beta, -alpha, depth - 1);
-                localResult.second = -localResult.second;
-                threadBoard.UndoMove<0>(prevState, from, to);
-                #pragma omp critical
+                else if (moveList.Count() == 0) {
+                    // No legal moves
+                    return std::make_pair(std::array<Move, maxDepth>(), 0);
+                }
+                constexpr Color Ocolor = Opposite(color);
+                //black minimizes, so the reduction keeps the best negated score
+                StockDory::BestChild<maxDepth> best;
+                typename Trace::Scope split("split", depth);
+                typename Stats::Region region;
+#pragma omp declare reduction(bestChild : StockDory::BestChild<maxDepth> : omp_out.Merge(omp_in))
+#pragma omp parallel reduction(bestChild : best)
                 {
-                    if (localResult.second > bestScore) {
-                        bestScore = localResult.second;
-                        bestLine[0] = nextMove;
-                        for (int j = 0; j < depth - 1; j++) {
-                            bestLine[j + 1] = localResult.first[j];
-                        }
-                        alpha = std::max(alpha, bestScore);
+                    region.Enter();
+                    //a thread joining the split copies the board once and makes/takes back every child on it,
+                    //a serialized (nested) region keeps working on the caller's board
+                    std::optional<StockDory::Board> threadCopy;
+                    if (omp_get_num_threads() > 1) {
+                        threadCopy.emplace(chessBoard);
+                    }
+                    StockDory::Board &localBoard = threadCopy ? *threadCopy : chessBoard;
+                    countSplit();
+                    uint64_t finished = now();
+#pragma omp for schedule(dynamic)
+                    for (uint8_t i = 0; i < moveList.Count(); i++) {
+                        Move nextMove = moveList[i];
+                        Square from = nextMove.From();
+                        Square to = nextMove.To();
+                        Piece promotion = nextMove.Promotion();
+                        typename Trace::Scope subtree("subtree", depth - 1);
+                        // Perform move
+                        PreviousState prevState = localBoard.Move<0>(from, to, promotion);
+                        std::pair<std::array<Move, maxDepth>, int> result = minimax<Ocolor, maxDepth>(localBoard, depth-1);
+                        // Update best score
+                        best.Update(i, nextMove, -result.second, true, result.first, depth);
+                        // Undo move
+                        localBoard.UndoMove<0>(prevState, from, to);
+                        finished = now();
+                    }
+                    region.Leave(finished);
+                    if (Trace::Active()) {
+                        Trace::Record("barrier", finished, now(), depth);
                     }
                 }
+                region.Close();
+                bestScore = -best.Score;
+                bestLine = best.Line;
             }
 
             return std::make_pair(bestLine, bestScore);
         }
 
-        //Below are the functions used to test how many times the critical sections and moves are checked.
-        template<Color color, int maxDepth>
-        std::pair<std::array<Move, maxDepth>, int> YBWCTest(const StockDory::Board &chessBoard, int alpha, int beta, int depth, std::atomic<int>& moveCount,std::atomic<int>& critCount) {
-            std::array<Move, maxDepth> bestLine;
-            int bestScore = -50000;
-            // create move list for player
-            const StockDory::SimplifiedMoveList<color> moveList(chessBoard);
-             //check for mate
-            if (moveList.Count() == 0 and chessBoard.Checked<color>()) {
-                return std::make_pair(std::array<Move, maxDepth>(), -mateScore-depth);
-            }
-            //stalemate
-            else if (moveList.Count() == 0){
-                return std::make_pair(std::array<Move, maxDepth>(), 0);
-            }
+        std::pair<Move, int> alphaBeta(StockDory::Board &chessBoard, int alpha, int beta, int depth) {
+            Stats::Add(StockDory::StatNodes);
+            //local variable of best move and best score
+            Move bestMove;
+            int bestScore;
+
+            //base-case -> when depth is 0, we evaluate the position score and return a default move (which will be overrided in the parent call)
             if (depth == 0) {
-                int score = evaluation.eval(chessBoard);
-                if (color == Black) {
-                    score *= -1;
-                }
-                return std::make_pair(std::array<Move, maxDepth>(), score);
+                int score = evaluate(chessBoard);
+                return std::make_pair(Move(), score);
             }
+            //Minimax on white turn -> try to score as high as possible
+            else if (chessBoard.ColorToMove() == White) {
+                //set best score to negative infinity at start
+                bestScore = -50000;
+                //create move list for white
+                const StockDory::SimplifiedMoveList<White> moveList(chessBoard);
+                //iterate through the moves and calculate the best score that can be reached from the next position
+                for (uint8_t i = 0; i < moveList.Count(); i++) {
+                    Move nextMove = moveList[i];
+                    Square from = nextMove.From();
+                    Square to = nextMove.To();
+                    //Perform move
+                    PreviousState prevState = chessBoard.Move<0>(from, to);
+                    std::pair<Move, int> result = alphaBeta(chessBoard, alpha, beta, depth-1);
+                    //update if we found a better move for white
+                    if (bestScore < result.second) {
+                        bestScore = result.second;
+                        bestMove = nextMove;
+                    }
+                    //Undo move
+                    chessBoard.UndoMove<0>(prevState, from, to);
+                    //alpha check
+                    alpha = std::max(alpha, result.second);
+                    if (beta <= alpha) {
+                        cutoff(i == 0);
+                        break;
+                    }
 
-            constexpr enum Color Ocolor = Opposite(color);
-
-            // Process the leftmost child sequentially
-            Move PV = moveList[0];
-            Square from = PV.From();
-            Square to = PV.To();
-            Piece promotion = PV.Promotion();
-            //create local copy for safety
-            StockDory::Board boardCopy = chessBoard;
-            PreviousState prevState = boardCopy.Move<0>(from, to, promotion);
-            std::pair<std::array<Move, maxDepth>, int> result = YBWCTest<Ocolor, maxDepth>(boardCopy, -beta, -alpha, depth - 1, moveCount, critCount);
-            moveCount++;
-            result.second = -result.second;
-            boardCopy.UndoMove<0>(prevState, from, to);
-            if (result.second > bestScore) {
-                bestScore = result.second;
-                bestLine[0] = PV;
-                //Store best line
-                for (int j = 0; j < depth - 1; j++) {
-                    bestLine[j + 1] = result.first[j];
                 }
-                alpha = std::max(alpha, bestScore);
-            }
-            //Cutoff
-            if (alpha >= beta) {
-                return std::make_pair(bestLine, bestScore);
             }
-            //Dynamic schedule since we do not know the ordering of moves or the number of moves in each call
-            #pragma omp parallel for shared(alpha, beta) schedule(dynamic)
-            for (uint8_t i = 1; i < moveList.Count(); i++) {
-                // int thread = omp_get_thread_num();
-                // // printf("%d\n", thread);
-                // printf("I hit the for loop for thread %d \n", thread);
-                // printf("Thread ID: %lu\n", (unsigned long)pthread_self());
-                if (alpha >= beta) {
-                    continue; // Mimic cutoff because you cannot break in
-                }
-                //Private copy of the board for each thread
-                StockDory::Board threadBoard = chessBoard;
-                Move nextMove = moveList[i];
-                Square from = nextMove.From();
-                Square to = nextMove.To();
-                Piece promotion = nextMove.Promotion();
-                PreviousState prevState = threadBoard.Move<0>(from, to, promotion);
-                std::pair<std::array<Move, maxDepth>, int> localResult = YBWCTest<Ocolor, maxDepth>(threadBoard, -beta, -alpha, depth - 1, moveCount, critCount);
-                moveCount++;
-                localResult.second = -localResult.second;
-                threadBoard.UndoMove<0>(prevState, from, to);
-                #pragma omp critical
-                {
-                    if (localResult.second > bestScore) {
-                        critCount++;
-                        bestScore = localResult.second;
-                        bestLine[0] = nextMove;
-                        for (int j = 0; j < depth - 1; j++) {
-                            bestLine[j + 1] = localResult.first[j];
-                        }
-                        alpha = std::max(alpha, bestScore);
+            //Minimax on black turn -> try to score as low as possible
+            else {
+                //set best score to positive infinity
+                bestScore = 50000;
+                //calculate possible moves for black
+                const StockDory::SimplifiedMoveList<Black> moveList(chessBoard);
+                //repeat the same thing as white but for black instead
+                for (uint8_t i = 0; i < moveList.Count(); i++) {
+                    Move nextMove = moveList[i];
+                    Square from = nextMove.From();
+                    Square to = nextMove.To();
+                    Piece promotion = nextMove.Promotion();
+                    //Perform move
+                    PreviousState prevState = chessBoard.Move<0>(from, to, promotion);
+                    std::pair<Move, int> result = alphaBeta(chessBoard, alpha, beta, depth-1);
+                    if (bestScore > result.second) {
+                        bestScore = result.second;
+                        bestMove = nextMove;
+                    }
+                    //Undo move
+                    chessBoard.UndoMove<0>(prevState, from, to);
+                    //beta check
+                    beta = std::min(beta, result.second);
+                    if (beta <= alpha) {
+                        cutoff(i == 0);
+                        break;
                     }
                 }
             }
+            return std::make_pair(bestMove, bestScore);
+        }
 
-            return std::make_pair(bestLine, bestScore);
+        //the recursive alpha-beta variants are all Engine::search, SearchPolicy.h describes how each one splits
+        template<Color color, int maxDepth>
+        std::pair<std::array<Move, maxDepth>, int> alphaBetaNega(StockDory::Board &chessBoard, int alpha, int beta, int depth, int ply = 0, int extensions = 0) {
+            return search<StockDory::SequentialSplit, color, maxDepth>(chessBoard, alpha, beta, depth, ply, extensions);
         }
-template<Color color, int maxDepth>
-        std::pair<std::array<Move, maxDepth>, int> PVSTest(const StockDory::Board &chessBoard, int alpha, int beta, int depth,std::atomic<int>& moveCount,std::atomic<int>& critCount) {
-            std::array<Move, maxDepth> bestLine;
-            int bestScore = -50000;
-            // create move list for player
-            const StockDory::SimplifiedMoveList<color> moveList(chessBoard);
-             //check for mate
-            if (moveList.Count() == 0 and chessBoard.Checked<color>()) {
-                return std::make_pair(std::array<Move, maxDepth>(), -mateScore-depth);
-            }
-            //stalemate
-            else if (moveList.Count() == 0){
-                return std::make_pair(std::array<Move, maxDepth>(), 0);
-            }
-            if (depth == 0) {
-                int score = evaluation.eval(chessBoard);
-                if (color == Black) {
-                    score *= -1;
-                }
-                return std::make_pair(std::array<Move, maxDepth>(), score);
-            }
 
-            constexpr enum Color Ocolor = Opposite(color);
+        template<Color color, int maxDepth>
+        std::pair<std::array<Move, maxDepth>, int> naiveParallelAlphaBeta(StockDory::Board &chessBoard, int alpha, int beta, int depth, int ply = 0, int extensions = 0) {
+            return search<StockDory::NaiveSplit, color, maxDepth>(chessBoard, alpha, beta, depth, ply, extensions);
+        }
 
-            // Process the leftmost child sequentially
-            Move PV = moveList[0];
-            Square from = PV.From();
-            Square to = PV.To();
-            Piece promotion = PV.Promotion();
-            //create local copy for safety
-            StockDory::Board boardCopy = chessBoard;
-            PreviousState prevState = boardCopy.Move<0>(from, to, promotion);
-            std::pair<std::array<Move, maxDepth>, int> result = PVSTest<Ocolor, maxDepth>(boardCopy, -beta, -alpha, depth - 1, moveCount, critCount);
-            moveCount++;
-            result.second = -result.second;
-            boardCopy.UndoMove<0>(prevState, from, to);
-            if (result.second > bestScore) {
-                bestScore = result.second;
-                bestLine[0] = PV;
-                //Store best line
-                for (int j = 0; j < depth - 1; j++) {
-                    bestLine[j + 1] = result.first[j];
-                }
-                alpha = std::max(alpha, bestScore);
-            }
-            //Cutoff
-            if (alpha >= beta) {
+        template<Color color, int maxDepth>
+        std::pair<std::array<Move, maxDepth>, int> naiveParallelPVAlphaBeta(StockDory::Board &chessBoard, int alpha, int beta, int depth, int ply = 0, int extensions = 0) {
+            return search<StockDory::NaivePVSplit, color, maxDepth>(chessBoard, alpha, beta, depth, ply, extensions);
+        }
 
-                return std::make_pair(bestLine, bestScore);
-            }
-            //Dynamic schedule since we do not know the ordering of moves or the number of moves in each call
-            #pragma omp parallel for shared(alpha, beta) schedule(dynamic)
-            for (uint8_t i = 1; i < moveList.Count(); i++) {
-                // int thread = omp_get_thread_num();
-                // // printf("%d\n", thread);
-                // printf("I hit the for loop for thread %d \n", thread);
-                if (alpha >= beta) {
-                    continue; // Mimic cutoff because you cannot break in
-                }
-                //Private copy of the board for each thread
-                StockDory::Board threadBoard = chessBoard;
-                Move nextMove = moveList[i];
-                Square from = nextMove.From();
-                Square to = nextMove.To();
-                Piece promotion = nextMove.Promotion();
-                PreviousState prevState = threadBoard.Move<0>(from, to, promotion);
-                std::pair<std::array<Move, maxDepth>, int> localResult = alphaBetaNegaParallelTest<Ocolor, maxDepth>(threadBoard, -beta, -alpha, depth - 1, moveCount, critCount);
-                moveCount++;
-                localResult.second = -localResult.second;
-                threadBoard.UndoMove<0>(prevState, from, to);
-                #pragma omp critical
-                {
-                    if (localResult.second > bestScore) {
-                        critCount++;
-                        bestScore = localResult.second;
-                        bestLine[0] = nextMove;
-                        for (int j = 0; j < depth - 1; j++) {
-                            bestLine[j + 1] = localResult.first[j];
-                        }
-                        alpha = std::max(alpha, bestScore);
-                    }
-                }
-            }
+        template<Color color, int maxDepth>
+        std::pair<std::array<Move, maxDepth>, int> YBWC(StockDory::Board &chessBoard, int alpha, int beta, int depth, int ply = 0, int extensions = 0) {
+            return search<StockDory::YBWCSplit, color, maxDepth>(chessBoard, alpha, beta, depth, ply, extensions);
+        }
 
-            return std::make_pair(bestLine, bestScore);
+        template<Color color, int maxDepth>
+        std::pair<std::array<Move, maxDepth>, int> PVS(StockDory::Board &chessBoard, int alpha, int beta, int depth, int ply = 0, int extensions = 0) {
+            return search<StockDory::PVSSplit, color, maxDepth>(chessBoard, alpha, beta, depth, ply, extensions);
         }
 
         template<Color color, int maxDepth>
-        std::pair<std::array<Move, maxDepth>, int> alphaBetaNegaParallelTest(const StockDory::Board &chessBoard, int alpha, int beta, int depth,std::atomic<int>& moveCount,std::atomic<int>& critCount) {
-            std::array<Move, maxDepth> bestLine;
-            int bestScore = -50000;
-            // create move list for player
-            const StockDory::SimplifiedMoveList<color> moveList(chessBoard);
-             //check for mate
-            if (moveList.Count() == 0 and chessBoard.Checked<color>()) {
-                return std::make_pair(std::array<Move, maxDepth>(), -mateScore-depth);
+        std::pair<std::array<Move, maxDepth>, int> alphaBetaNegaParallel(StockDory::Board &chessBoard, int alpha, int beta, int depth, int ply = 0, int extensions = 0) {
+            return search<StockDory::ParallelSplit, color, maxDepth>(chessBoard, alpha, beta, depth, ply, extensions);
+        }
+
+        //empties the ABDADA table, for a search that must not start from what the searches before it left
+        void clearHash() {
+            if (abdadaTable) {
+                abdadaTable->Clear();
             }
-            //stalemate
-            else if (moveList.Count() == 0){
-                return std::make_pair(std::array<Move, maxDepth>(), 0);
+        }
+
+        //ABDADA: every thread searches the same tree on its own board, the shared hash table spreads them over different siblings
+        template<Color color, int maxDepth>
+        std::pair<std::array<Move, maxDepth>, int> ABDADA(StockDory::Board &chessBoard, int alpha, int beta, int depth) {
+            //mapped and first touched by the team that will search it
+            if (!abdadaTable) {
+                abdadaTable = std::make_unique<StockDory::TranspositionTable<StockDory::HashCluster>>(16 * 1024 * 1024, true);
             }
-            if (depth == 0) {
-                int score = evaluation.eval(chessBoard);
-                if (color == Black) {
-                    score *= -1;
+            //entries of earlier searches are kept, but are the first to be replaced
+            abdadaTable->NewSearch();
+            std::pair<std::array<Move, maxDepth>, int> result;
+            typename Stats::Region region;
+            #pragma omp parallel
+            {
+                region.Enter();
+                //one board per thread for the whole search, children are made and unmade in place
+                StockDory::Board threadBoard = chessBoard;
+                std::pair<std::array<Move, maxDepth>, int> threadResult;
+                //iterative deepening leaves a best move in the table for the next iteration to search first
+                for (int d = 1; d <= depth; d++) {
+                    threadResult = search<StockDory::ABDADASplit, color, maxDepth>(threadBoard, alpha, beta, d, 0, 0);
+                }
+                //the threads finish their last iteration at different times and wait for the slowest one
+                region.Leave(Stats::Now());
+                if (omp_get_thread_num() == 0) {
+                    result = threadResult;
                 }
-                return std::make_pair(std::array<Move, maxDepth>(), score);
             }
+            region.Close();
+            return result;
+        }
 
-            constexpr enum Color Ocolor = Opposite(color);
-            //Dynamic schedule since we do not know the ordering of moves or the number of moves in each call
-            #pragma omp parallel for shared(alpha, beta) schedule(dynamic)
-            for (uint8_t i = 0; i < moveList.Count(); i++) {
-                // int thread = omp_get_thread_num();
-                // // printf("%d\n", thread);
-                // printf("I hit the for loop for thread %d \n", thread);
-                if (alpha >= beta) {
-                    continue; // Mimic cutoff because you cannot break in
+        //YBWC on OpenMP tasks: one parallel region for the whole search, younger brothers become tasks in a taskgroup
+        //that is cancelled on a beta cutoff, and below taskSequentialDepth the sequential alphaBetaNega takes over
+        template<Color color, int maxDepth>
+        std::pair<std::array<Move, maxDepth>, int> YBWCTask(StockDory::Board &chessBoard, int alpha, int beta, int depth) {
+            std::pair<std::array<Move, maxDepth>, int> result;
+            //the threads outside the single run tasks while they wait, so a thread is idle whenever it runs neither the root nor a task
+            typename Stats::Region region;
+            #pragma omp parallel
+            {
+                region.Enter();
+                const uint64_t entered = now();
+                #pragma omp single
+                {
+                    typename Stats::Busy busy;
+                    result = ybwcTask<color, maxDepth>(chessBoard, alpha, beta, depth, 0, 0);
                 }
-                //Private copy of the board for each thread
-                StockDory::Board threadBoard = chessBoard;
-                Move nextMove = moveList[i];
-                Square from = nextMove.From();
-                Square to = nextMove.To();
-                Piece promotion = nextMove.Promotion();
-                PreviousState prevState = threadBoard.Move<0>(from, to, promotion);
-                std::pair<std::array<Move, maxDepth>, int> localResult = alphaBetaNegaParallelTest<Ocolor, maxDepth>(threadBoard, -beta, -alpha, depth - 1, moveCount, critCount);
-                moveCount++;
-                localResult.second = -localResult.second;
+                region.Leave(entered + Stats::Busy::Take());
+            }
+            region.Close();
+            return result;
+        }
 
-                threadBoard.UndoMove<0>(prevState, from, to);
-                #pragma omp critical
+        //Dynamic Tree Splitting: thread 0 searches the root, idle threads join split points published from any frame of a busy thread's stack
+        template<Color color, int maxDepth>
+        std::pair<std::array<Move, maxDepth>, int> DTS(StockDory::Board &chessBoard, int alpha, int beta, int depth) {
+            StockDory::DTSShared<maxDepth> shared;
+            std::vector<std::unique_ptr<StockDory::DTSThread<maxDepth>>> threads;
+            std::pair<std::array<Move, maxDepth>, int> result;
+            typename Stats::Region region;
+            #pragma omp parallel
+            {
+                region.Enter();
+                //every thread allocates its own frames and split points, so a pinned thread first touches them on its own node
+                #pragma omp single
                 {
-                    if (localResult.second > bestScore) {
-                        critCount++;
-                        bestScore = localResult.second;
-                        bestLine[0] = nextMove;
-                        for (int j = 0; j < depth - 1; j++) {
-                            bestLine[j + 1] = localResult.first[j];
+                    threads.resize(omp_get_num_threads());
+                    shared.Threads.resize(omp_get_num_threads());
+                }
+                threads[omp_get_thread_num()] = std::make_unique<StockDory::DTSThread<maxDepth>>();
+                shared.Threads[omp_get_thread_num()] = threads[omp_get_thread_num()].get();
+                #pragma omp barrier
+                StockDory::DTSThread<maxDepth> &thread = *threads[omp_get_thread_num()];
+                if (omp_get_thread_num() == 0) {
+                    StockDory::Board board = chessBoard;
+                    thread.Frames[0].Reset(alpha, beta, depth, 0, 0);
+                    bool aborted;
+                    int score = dtsSearch<maxDepth>(shared, thread, board, 0, nullptr, aborted);
+                    result = std::make_pair(thread.Frames[0].BestLine, score);
+                    shared.Finished = true;
+                }
+                else {
+                    //advertise as idle until the root search is done
+                    shared.Idle++;
+                    while (!shared.Finished) {
+                        const uint64_t looked = Stats::Now();
+                        if (!dtsHelp<maxDepth>(shared, thread, 0, nullptr, true)) {
+                            std::this_thread::yield();
+                            Stats::Add(StockDory::StatIdleNanoseconds, Stats::Now() - looked);
                         }
-                        alpha = std::max(alpha, bestScore);
                     }
+                    shared.Idle--;
                 }
+                region.Leave(Stats::Now());
             }
-
-            return std::make_pair(bestLine, bestScore);
+            region.Close();
+            return result;
         }
 
 };
@@ -0,0 +1,160 @@
+//
+// Shared hash table of the ABDADA search, one HashCluster of entries per cache line.
+// Busy counts the threads currently searching a position.
+//
+
+#ifndef STOCKDORY_HASHENTRY_H
+#define STOCKDORY_HASHENTRY_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include "Backend/Type/Move.h"
+#include "Backend/Type/Zobrist.h"
+
+namespace StockDory
+{
+
+    enum Bound : uint8_t
+    {
+        BoundNone ,
+        BoundUpper,
+        BoundLower,
+        BoundExact
+    };
+
+    struct HashData
+    {
+        ::Move  BestMove = {};
+        int     Score    = 0;
+        uint8_t Depth    = 0;
+        Bound   Type     = BoundNone;
+    };
+
+    // One cache line of the table: a probe or a store touches exactly one line, which Prefetch can bring in ahead.
+    // Every entry is a single 64-bit word, so a thread never reads half of an entry another thread is writing.
+    // The first entries are depth-preferred, the last one always takes what the others refuse. A stored entry keeps
+    // the table's generation, so entries from earlier searches are replaced first without clearing the table.
+    // ABDADA's busy counters sit in the same line, picked by the key check, so two positions may share a counter:
+    // at worst a move is deferred that did not need to be.
+    class alignas(64) HashCluster
+    {
+
+    private:
+        // [  KEY  ] [ MOVE  ] [ SCORE ] [ DEPTH ] [ GENERATION ] [ BOUND ]
+        // [16 BITS] [16 BITS] [16 BITS] [ 8 BITS] [   6 BITS   ] [2 BITS ]
+        static constexpr uint8_t EntryCount      = 7;
+        static constexpr uint8_t AlwaysReplace   = EntryCount - 1;
+        static constexpr uint8_t GenerationCycle = 64;
+
+        std::array<std::atomic<uint64_t>, EntryCount> Entries   = {};
+        std::array<std::atomic<uint8_t >, 8         > Searching = {};
+
+        static inline uint16_t Check(const ZobristHash hash)
+        {
+            // the table indexes with the high bits of the hash, the check uses the low ones
+            return static_cast<uint16_t>(hash);
+        }
+
+        static inline uint8_t Generation(const uint64_t entry)
+        {
+            return static_cast<uint8_t>(entry) >> 2;
+        }
+
+        static inline uint8_t Depth(const uint64_t entry)
+        {
+            return static_cast<uint8_t>(entry >> 8);
+        }
+
+        static inline Bound Type(const uint64_t entry)
+        {
+            return static_cast<Bound>(entry & 0x3);
+        }
+
+        // Generations since the entry was stored, the counter wraps around
+        static inline uint8_t Age(const uint64_t entry, const uint8_t generation)
+        {
+            return (generation - Generation(entry) + GenerationCycle) % GenerationCycle;
+        }
+
+    public:
+        inline bool Probe(const ZobristHash hash, HashData& out) const
+        {
+            for (const std::atomic<uint64_t>& slot : Entries) {
+                const uint64_t entry = slot.load(std::memory_order_relaxed);
+                if (Type(entry) == BoundNone || entry >> 48 != Check(hash)) continue;
+
+                const auto move = static_cast<uint16_t>(entry >> 32);
+                out.BestMove = ::Move(static_cast<Square>(move & 0x3F), static_cast<Square>((move >> 6) & 0x3F),
+                                      static_cast<Piece >((move >> 12) & 0xF));
+                out.Score    = static_cast<int16_t>(entry >> 16);
+                out.Depth    = Depth(entry);
+                out.Type     = Type (entry);
+                return true;
+            }
+
+            return false;
+        }
+
+        inline void Store(const ZobristHash hash, const ::Move move, const int score, const uint8_t depth,
+                          const Bound type, const uint8_t generation)
+        {
+            const uint64_t packedMove = move.From() | (move.To() << 6) | (move.Promotion() << 12);
+            const auto     packedScore = static_cast<uint16_t>(static_cast<int16_t>(std::clamp(score, -32767, 32767)));
+            const uint64_t entry = static_cast<uint64_t>(Check(hash)) << 48
+                                 | packedMove << 32
+                                 | static_cast<uint64_t>(packedScore) << 16
+                                 | static_cast<uint64_t>(depth) << 8
+                                 | static_cast<uint64_t>(generation % GenerationCycle) << 2
+                                 | type;
+
+            // The same position again, or an empty entry
+            for (std::atomic<uint64_t>& slot : Entries) {
+                const uint64_t current = slot.load(std::memory_order_relaxed);
+                if (Type(current) == BoundNone || current >> 48 == Check(hash)) {
+                    slot.store(entry, std::memory_order_relaxed);
+                    return;
+                }
+            }
+
+            // Depth-preferred: the shallowest entry, counting each generation of age as a lost ply, if it is worth
+            // less than the new one. Otherwise the always-replace entry takes it.
+            uint8_t victim = AlwaysReplace;
+            int     worst  = depth;
+            for (uint8_t i = 0; i < AlwaysReplace; i++) {
+                const uint64_t current = Entries[i].load(std::memory_order_relaxed);
+                const int      worth   = Depth(current) - 8 * Age(current, generation);
+                if (worth < worst || (worth == worst && Age(current, generation) > 0)) {
+                    victim = i;
+                    worst  = worth;
+                }
+            }
+
+            Entries[victim].store(entry, std::memory_order_relaxed);
+        }
+
+        inline void Enter(const ZobristHash hash)
+        {
+            Searching[Check(hash) % Searching.size()].fetch_add(1, std::memory_order_relaxed);
+        }
+
+        inline void Leave(const ZobristHash hash)
+        {
+            Searching[Check(hash) % Searching.size()].fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]]
+        inline bool Busy(const ZobristHash hash) const
+        {
+            return Searching[Check(hash) % Searching.size()].load(std::memory_order_relaxed) != 0;
+        }
+
+    };
+
+    static_assert(sizeof(HashCluster) == 64, "a cluster is one cache line");
+
+} // StockDory
+
+#endif //STOCKDORY_HASHENTRY_H
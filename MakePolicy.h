@@ -0,0 +1,95 @@
+//
+// How the searches step from a node to its children.
+// MakeUnmake makes the move on the node's own board and takes it back from the saved PreviousState, CopyMake copies
+// the board into the searching thread's slot for the child's ply and makes the move there, so taking it back is free.
+// Both hand the child board back in a Child, the searches only ever use Child::Position between Make and Undo.
+//
+
+#ifndef STOCKDORY_MAKEPOLICY_H
+#define STOCKDORY_MAKEPOLICY_H
+
+#include <array>
+#include <cassert>
+#include <memory>
+
+#include "Backend/Board.h"
+#include "Backend/Template/MoveType.h"
+#include "Backend/Type/PreviousState.h"
+
+namespace StockDory
+{
+
+    struct MakeUnmake
+    {
+        // The node's board changes while a child is searched, so threads sharing a node need their own copy.
+        static constexpr bool MakesInPlace = true;
+
+        struct Child
+        {
+            Board&        Position;
+            PreviousState State;
+        };
+
+        template<MoveType T = 0>
+        static inline Child Make(Board& board, const int /*ply*/, const Square from, const Square to,
+                                 const Piece promotion = NAP)
+        {
+            return { board, board.Move<T>(from, to, promotion) };
+        }
+
+        template<MoveType T = 0>
+        static inline void Undo(Board& board, const Child& child, const Square from, const Square to)
+        {
+            board.UndoMove<T>(child.State, from, to);
+        }
+    };
+
+    struct CopyMake
+    {
+        // Covers the nominal depth, check extensions and the longest capture sequence quiescence can follow.
+        static constexpr int StackSize = 256;
+
+        static constexpr bool MakesInPlace = false;
+
+        struct Child
+        {
+            Board& Position;
+        };
+
+        // The board of a node at ply p lives in slot p (or is the caller's board at the root), so the child always
+        // goes into slot p + 1 and never overwrites a board an ancestor on the same thread is still searching.
+        template<MoveType T = 0>
+        static inline Child Make(Board& board, const int ply, const Square from, const Square to,
+                                 const Piece promotion = NAP)
+        {
+            assert(ply + 1 < StackSize);
+
+            Board& child = Stack()[ply + 1];
+            child = board;
+            child.Move<T>(from, to, promotion);
+            return { child };
+        }
+
+        template<MoveType T = 0>
+        static inline void Undo(Board&, const Child&, const Square, const Square) {}
+
+    private:
+        // Allocated by the thread on first use, not with the thread's TLS block (which the thread that creates it
+        // zeroes), so a pinned thread's boards are first touched on its own NUMA node.
+        static inline std::array<Board, StackSize>& Stack()
+        {
+            static thread_local std::unique_ptr<std::array<Board, StackSize>> stack =
+                    std::make_unique<std::array<Board, StackSize>>();
+            return *stack;
+        }
+    };
+
+#ifdef STOCKDORY_COPY_MAKE
+    using DefaultMakePolicy = CopyMake;
+#else
+    using DefaultMakePolicy = MakeUnmake;
+#endif
+
+} // StockDory
+
+#endif //STOCKDORY_MAKEPOLICY_H
@@ -0,0 +1,122 @@
+//
+// Ordered view over SimplifiedMoveList for the alpha-beta searches.
+// Captures that win or break even under static exchange come first (most valuable victim, least valuable attacker),
+// then quiet moves, then captures that lose material. Moves with equal scores keep the generator's order.
+//
+
+#ifndef STOCKDORY_ORDEREDMOVELIST_H
+#define STOCKDORY_ORDEREDMOVELIST_H
+
+#include <array>
+#include <cassert>
+
+#include "SimplifiedMoveList.h"
+
+namespace StockDory
+{
+
+    template<Color Color, bool CaptureOnly = false>
+    class OrderedMoveList
+    {
+
+    private:
+        static constexpr int MaxMove = 256;
+
+        static constexpr int16_t GoodCapture         =  20000;
+        static constexpr int16_t UnderPromotion      = -1000 ;
+        static constexpr int16_t LosingCaptureCutoff = -10000;
+        static constexpr int16_t BadCapture          = -20000;
+
+        std::array<Move   , MaxMove> Internal = {};
+        std::array<int16_t, MaxMove> Scores   = {};
+        uint8_t Size = 0;
+
+    public:
+        explicit OrderedMoveList(const Board& board) :
+                OrderedMoveList(board, SimplifiedMoveList<Color, CaptureOnly>(board)) {}
+
+        OrderedMoveList(const Board& board, const SimplifiedMoveList<Color, CaptureOnly>& moves)
+        {
+            for (uint8_t i = 0; i < moves.Count(); i++) {
+                const Move    move  = moves[i];
+                const int16_t score = ScoreMove(board, move);
+
+                // Insertion sort, the lists are short and mostly quiet moves.
+                uint8_t j = Size++;
+                for (; j > 0 && Scores[j - 1] < score; j--) {
+                    Internal[j] = Internal[j - 1];
+                    Scores  [j] = Scores  [j - 1];
+                }
+
+                Internal[j] = move ;
+                Scores  [j] = score;
+            }
+        }
+
+        [[nodiscard]]
+        inline Move operator [](const uint8_t index) const
+        {
+            assert(index < Size);
+            return Internal[index];
+        }
+
+        [[nodiscard]]
+        inline uint8_t Count() const
+        {
+            return Size;
+        }
+
+        [[nodiscard]]
+        inline bool LosingCapture(const uint8_t index) const
+        {
+            assert(index < Size);
+            return Scores[index] < LosingCaptureCutoff;
+        }
+
+        [[nodiscard]]
+        inline bool WinningCapture(const uint8_t index) const
+        {
+            assert(index < Size);
+            return Scores[index] >= GoodCapture;
+        }
+
+        // Moves the move at index to the front, the rest keep their relative order.
+        inline void Promote(const uint8_t index)
+        {
+            assert(index < Size);
+            const Move    move  = Internal[index];
+            const int16_t score = Scores  [index];
+
+            for (uint8_t j = index; j > 0; j--) {
+                Internal[j] = Internal[j - 1];
+                Scores  [j] = Scores  [j - 1];
+            }
+
+            Internal[0] = move ;
+            Scores  [0] = score;
+        }
+
+    private:
+        static inline int16_t ScoreMove(const Board& board, const Move move)
+        {
+            const Piece attacker = board[move.From()].Piece();
+                  Piece victim   = board[move.To  ()].Piece();
+
+            if (attacker == Pawn && board.EnPassant() && move.To() == board.EnPassantSquare()) victim = Pawn;
+
+            if (victim == NAP) {
+                if (move.Promotion() == NAP  ) return 0;
+                if (move.Promotion() == Queen) return GoodCapture + 8 * Queen;
+                return UnderPromotion;
+            }
+
+            const auto mvvLva = static_cast<int16_t>(8 * victim - attacker);
+
+            return board.SEE(move, 0) ? GoodCapture + mvvLva : BadCapture + mvvLva;
+        }
+
+    };
+
+} // StockDory
+
+#endif //STOCKDORY_ORDEREDMOVELIST_H
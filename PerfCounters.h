@@ -0,0 +1,256 @@
+//
+// Hardware performance counters of the search threads, attributed to the phases of a search: move generation,
+// make/unmake, static evaluation and hash probes.
+// Every thread opens its own group of counters with perf_event_open (user space only) the first time it enters a phase
+// after Start, and reads the whole group with one read() when the phase begins and ends. The difference is added to
+// the thread's slot for that phase, the same way SearchStats counts. The reads are system calls, so a counted search
+// runs several times slower than a normal one: compare the counts of two builds, not their times.
+// Off Linux, or where the kernel does not give out the counters (perf_event_paranoid, containers), Start returns false
+// and a phase costs the load of one flag.
+//
+
+#ifndef STOCKDORY_PERFCOUNTERS_H
+#define STOCKDORY_PERFCOUNTERS_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace StockDory
+{
+
+    enum SearchPhase : uint8_t
+    {
+        PhaseMoveGen   , // attacks, legal move generation and ordering
+        PhaseMakeUnmake,
+        PhaseEval      ,
+        PhaseHashProbe ,
+        SearchPhaseCount
+    };
+
+    enum PerfCounter : uint8_t
+    {
+        PerfCycles      ,
+        PerfInstructions,
+        PerfL1DMisses   , // level 1 data cache read misses
+        PerfLLCMisses   , // last level cache misses
+        PerfBranchMisses,
+        PerfCounterCount
+    };
+
+    // Names for reports, in SearchPhase and PerfCounter order.
+    constexpr std::array<const char*, SearchPhaseCount> SearchPhaseNames = {
+        "movegen", "make_unmake", "eval", "hash_probe"
+    };
+
+    constexpr std::array<const char*, PerfCounterCount> PerfCounterNames = {
+        "cycles", "instructions", "l1d_misses", "llc_misses", "branch_misses"
+    };
+
+    struct PerfTotals
+    {
+        std::array<std::array<uint64_t, PerfCounterCount>, SearchPhaseCount> Counts = {};
+
+        inline uint64_t operator ()(const SearchPhase phase, const PerfCounter counter) const
+        {
+            return Counts[phase][counter];
+        }
+
+        [[nodiscard]]
+        inline double IPC(const SearchPhase phase) const
+        {
+            return Counts[phase][PerfCycles] ? static_cast<double>(Counts[phase][PerfInstructions]) /
+                                               static_cast<double>(Counts[phase][PerfCycles]) : 0;
+        }
+    };
+
+    class PerfCounters
+    {
+
+        private:
+            using Reading = std::array<uint64_t, PerfCounterCount>;
+
+            // a page of its own, allocated and zeroed by its thread: first touched on the thread's NUMA node
+            struct alignas(4096) Slot
+            {
+                std::array<std::array<std::atomic<uint64_t>, PerfCounterCount>, SearchPhaseCount> Counts = {};
+            };
+
+            // The counters of one thread: the cycles lead the group, a counter the CPU lacks is left out of it
+            struct Group
+            {
+                int                                  Leader = -1;
+                std::array<int, PerfCounterCount>    Descriptors;
+                std::array<int8_t, PerfCounterCount> Index ;
+                uint8_t                              Opened = 0;
+
+                Group()
+                {
+                    Descriptors.fill(-1);
+                    Index.fill(-1);
+#ifdef __linux__
+                    constexpr std::array<std::pair<uint32_t, uint64_t>, PerfCounterCount> events = {{
+                        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES      },
+                        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS    },
+                        {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | PERF_COUNT_HW_CACHE_OP_READ << 8 |
+                                             PERF_COUNT_HW_CACHE_RESULT_MISS << 16},
+                        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES    },
+                        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES   }
+                    }};
+
+                    for (uint8_t i = 0; i < PerfCounterCount; i++) {
+                        perf_event_attr attr = {};
+                        attr.size           = sizeof(attr);
+                        attr.type           = events[i].first;
+                        attr.config         = events[i].second;
+                        attr.exclude_kernel = 1;
+                        attr.exclude_hv     = 1;
+                        attr.read_format    = PERF_FORMAT_GROUP;
+
+                        const int descriptor = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, Leader, 0));
+                        if (descriptor < 0) {
+                            if (i == PerfCycles) return;
+                            continue;
+                        }
+
+                        if (i == PerfCycles) Leader = descriptor;
+                        Descriptors[i] = descriptor;
+                        Index      [i] = static_cast<int8_t>(Opened++);
+                    }
+#endif
+                }
+
+                ~Group()
+                {
+#ifdef __linux__
+                    for (const int descriptor : Descriptors) if (descriptor >= 0) close(descriptor);
+#endif
+                }
+
+                inline bool Read(Reading& reading) const
+                {
+#ifdef __linux__
+                    if (Leader < 0) return false;
+
+                    // PERF_FORMAT_GROUP: the number of counters, then their values in the order they were opened
+                    std::array<uint64_t, PerfCounterCount + 1> values;
+                    if (read(Leader, values.data(), sizeof(values)) <= 0) return false;
+
+                    for (uint8_t i = 0; i < PerfCounterCount; i++)
+                        reading[i] = Index[i] < 0 ? 0 : values[Index[i] + 1];
+
+                    return true;
+#else
+                    return false;
+#endif
+                }
+            };
+
+            static inline std::mutex        SlotLock;
+            static inline std::deque<Slot>  Slots   ;
+            static inline std::atomic<bool> Counting = false;
+
+            static inline Slot& Register()
+            {
+                std::lock_guard<std::mutex> guard(SlotLock);
+                return Slots.emplace_back();
+            }
+
+            static inline Slot& Local()
+            {
+                thread_local Slot& slot = Register();
+                return slot;
+            }
+
+            static inline const Group& LocalGroup()
+            {
+                thread_local const Group group;
+                return group;
+            }
+
+        public:
+            // Counts from now on, false if this thread could not open its counters
+            static inline bool Start()
+            {
+                if (LocalGroup().Leader < 0) return false;
+
+                Counting = true;
+                return true;
+            }
+
+            static inline bool Active()
+            {
+                return Counting.load(std::memory_order_relaxed);
+            }
+
+            static inline PerfTotals Total()
+            {
+                std::lock_guard<std::mutex> guard(SlotLock);
+
+                PerfTotals totals;
+                for (const Slot& slot : Slots)
+                    for (uint8_t phase = 0; phase < SearchPhaseCount; phase++)
+                        for (uint8_t counter = 0; counter < PerfCounterCount; counter++)
+                            totals.Counts[phase][counter] += slot.Counts[phase][counter].load(std::memory_order_relaxed);
+
+                return totals;
+            }
+
+            static inline void Reset()
+            {
+                std::lock_guard<std::mutex> guard(SlotLock);
+
+                for (Slot& slot : Slots) for (auto& phase : slot.Counts) for (std::atomic<uint64_t>& counter : phase)
+                    counter.store(0, std::memory_order_relaxed);
+            }
+
+            // Counts the phase from its construction to Stop or its end of scope. Phases never nest.
+            class Phase
+            {
+
+                private:
+                    const SearchPhase Which;
+                    Reading           Begin  ;
+                    bool              Running = false;
+
+                public:
+                    explicit Phase(const SearchPhase which) : Which(which)
+                    {
+                        if (Active()) Running = LocalGroup().Read(Begin);
+                    }
+
+                    inline void Stop()
+                    {
+                        if (!Running) return;
+                        Running = false;
+
+                        Reading end;
+                        if (!LocalGroup().Read(end)) return;
+
+                        auto& counts = Local().Counts[Which];
+                        for (uint8_t i = 0; i < PerfCounterCount; i++)
+                            counts[i].store(counts[i].load(std::memory_order_relaxed) + end[i] - Begin[i],
+                                            std::memory_order_relaxed);
+                    }
+
+                    ~Phase()
+                    {
+                        Stop();
+                    }
+
+            };
+
+    };
+
+} // StockDory
+
+#endif //STOCKDORY_PERFCOUNTERS_H
@@ -0,0 +1,95 @@
+//
+// What a node of Engine::search does, fixed at compile time so every variant is its own fully specialised kernel.
+//   Parallel     the moves after the sequential ones are split over the threads of an OpenMP loop
+//   EldestFirst  a splitting node searches its first move on its own before the split (young brothers wait)
+//   Younger      the node type the split searches its moves with, the sequential moves always recurse into the same type
+//   IID          internal iterative deepening picks the first move
+//   Table        probe and store the ABDADA hash table and defer the siblings another thread is already searching
+//
+
+#ifndef STOCKDORY_SEARCHPOLICY_H
+#define STOCKDORY_SEARCHPOLICY_H
+
+namespace StockDory
+{
+
+    // alphaBetaNega
+    struct SequentialSplit
+    {
+        static constexpr bool Parallel    = false;
+        static constexpr bool EldestFirst = false;
+        static constexpr bool IID         = false;
+        static constexpr bool Table       = false;
+
+        using Younger = SequentialSplit;
+    };
+
+    // naiveParallelAlphaBeta: only the root splits, every move at once
+    struct NaiveSplit
+    {
+        static constexpr bool Parallel    = true;
+        static constexpr bool EldestFirst = false;
+        static constexpr bool IID         = false;
+        static constexpr bool Table       = false;
+
+        using Younger = SequentialSplit;
+    };
+
+    // naiveParallelPVAlphaBeta: the nodes on the leftmost line split after their eldest brother
+    struct NaivePVSplit
+    {
+        static constexpr bool Parallel    = true;
+        static constexpr bool EldestFirst = true;
+        static constexpr bool IID         = false;
+        static constexpr bool Table       = false;
+
+        using Younger = SequentialSplit;
+    };
+
+    // alphaBetaNegaParallel: every node splits every move at once
+    struct ParallelSplit
+    {
+        static constexpr bool Parallel    = true;
+        static constexpr bool EldestFirst = false;
+        static constexpr bool IID         = false;
+        static constexpr bool Table       = false;
+
+        using Younger = ParallelSplit;
+    };
+
+    // YBWC: every node splits after its eldest brother
+    struct YBWCSplit
+    {
+        static constexpr bool Parallel    = true;
+        static constexpr bool EldestFirst = true;
+        static constexpr bool IID         = true;
+        static constexpr bool Table       = false;
+
+        using Younger = YBWCSplit;
+    };
+
+    // PVS: the leftmost line splits after its eldest brother, the younger brothers split everything at once
+    struct PVSSplit
+    {
+        static constexpr bool Parallel    = true;
+        static constexpr bool EldestFirst = true;
+        static constexpr bool IID         = true;
+        static constexpr bool Table       = false;
+
+        using Younger = ParallelSplit;
+    };
+
+    // ABDADA: every thread runs sequential nodes on its own board, the shared table spreads them over the siblings
+    struct ABDADASplit
+    {
+        static constexpr bool Parallel    = false;
+        static constexpr bool EldestFirst = false;
+        static constexpr bool IID         = false;
+        static constexpr bool Table       = true;
+
+        using Younger = ABDADASplit;
+    };
+
+} // StockDory
+
+#endif //STOCKDORY_SEARCHPOLICY_H
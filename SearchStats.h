@@ -0,0 +1,255 @@
+//
+// Search statistics, compiled in or out by the Engine's Stats policy.
+// SearchStats counts into a slot per thread, on a page of its own and written only by that thread, so counting
+// costs a plain increment and no sharing. NoSearchStats is the default: every Add is an empty inline call and the
+// searches compile to the same code as without statistics.
+// The slots are global like the searches' thread-local board stacks, a thread that ends still adds to the total.
+// Besides the counters the policy times the two parallel overheads that are not extra nodes: synchronization (waiting to
+// be forked into a region, for a split point lock or for the helpers of a split to join) and idle time (a thread out of
+// work, waiting at the implicit barrier that ends a region or looking for a split point to help). Lock and Region are the
+// policy's lock guard and region timer, Busy times the tasks of a task-based region for it. NoSearchStats gives a plain
+// lock guard and empty timers.
+// Phase is the scope of one search phase for the hardware counters of PerfCounters.h, which only count once started.
+//
+
+#ifndef STOCKDORY_SEARCHSTATS_H
+#define STOCKDORY_SEARCHSTATS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+
+#include "PerfCounters.h"
+
+namespace StockDory
+{
+
+    enum SearchStat : uint8_t
+    {
+        StatNodes           , // every node entered, quiescence included
+        StatLeafEvals       , // static evaluations
+        StatHashProbes      ,
+        StatHashHits        ,
+        StatBetaCutoffs     , // fail highs of full-width nodes
+        StatFirstMoveCutoffs, // cutoffs by the first move searched
+        StatSplits          , // nodes whose children were handed to more than one thread
+        StatAborts          , // moves or subtrees dropped because a sibling already cut the node off
+        StatCriticalSections, // updates of state shared between threads (alpha, split points)
+        StatSyncNanoseconds , // time spent waiting on other threads to fork, unlock or join, summed over threads
+        StatIdleNanoseconds , // time spent out of work, summed over threads
+        SearchStatCount
+    };
+
+    // Column names for reports, in SearchStat order.
+    constexpr std::array<const char*, SearchStatCount> SearchStatNames = {
+        "nodes", "leaf_evals", "hash_probes", "hash_hits", "beta_cutoffs", "first_move_cutoffs", "splits", "aborts",
+        "critical_sections", "sync_ns", "idle_ns"
+    };
+
+    struct SearchStatTotals
+    {
+        std::array<uint64_t, SearchStatCount> Counts = {};
+
+        inline uint64_t operator [](const SearchStat stat) const
+        {
+            return Counts[stat];
+        }
+
+        [[nodiscard]]
+        inline double FirstMoveCutoffRate() const
+        {
+            return Counts[StatBetaCutoffs] ? static_cast<double>(Counts[StatFirstMoveCutoffs]) /
+                                             static_cast<double>(Counts[StatBetaCutoffs]) : 0;
+        }
+    };
+
+    class SearchStats
+    {
+
+        private:
+            // a page of its own, allocated and zeroed by its thread: first touched on the thread's NUMA node
+            struct alignas(4096) Slot
+            {
+                std::array<std::atomic<uint64_t>, SearchStatCount> Counts = {};
+            };
+
+            static inline std::mutex       SlotLock;
+            static inline std::deque<Slot> Slots;
+
+            static inline Slot& Register()
+            {
+                std::lock_guard<std::mutex> guard(SlotLock);
+                return Slots.emplace_back();
+            }
+
+            static inline Slot& Local()
+            {
+                thread_local Slot& slot = Register();
+                return slot;
+            }
+
+        public:
+            static constexpr bool Enabled = true;
+
+            static inline void Add(const SearchStat stat, const uint64_t count = 1)
+            {
+                std::atomic<uint64_t>& counter = Local().Counts[stat];
+                counter.store(counter.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+            }
+
+            static inline uint64_t Now()
+            {
+                return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now().time_since_epoch()).count();
+            }
+
+            // A lock guard that counts a critical section and the time spent waiting for the lock
+            class Lock
+            {
+
+                private:
+                    const uint64_t              Requested = Now();
+                    std::lock_guard<std::mutex> Guard;
+
+                public:
+                    explicit Lock(std::mutex& mutex) : Guard(mutex)
+                    {
+                        Add(StatCriticalSections);
+                        Add(StatSyncNanoseconds, Now() - Requested);
+                    }
+
+            };
+
+            // Timer of one parallel region, built by the thread that forks it. Every thread of the region calls Enter
+            // first, which counts the fork as synchronization, and Leave with the time it finished its last piece of
+            // work. Close, after the region, counts the time from there to the end of the region as idle.
+            class Region
+            {
+
+                private:
+                    const uint64_t        Forked   = Now();
+                    std::atomic<uint64_t> Finished = 0; // summed over the threads
+                    std::atomic<uint64_t> Threads  = 0;
+
+                public:
+                    inline void Enter() const
+                    {
+                        Add(StatSyncNanoseconds, Now() - Forked);
+                    }
+
+                    inline void Leave(const uint64_t finished)
+                    {
+                        Finished.fetch_add(finished, std::memory_order_relaxed);
+                        Threads.fetch_add(1, std::memory_order_relaxed);
+                    }
+
+                    inline void Close() const
+                    {
+                        Add(StatIdleNanoseconds, Threads.load(std::memory_order_relaxed) * Now() -
+                                                 Finished.load(std::memory_order_relaxed));
+                    }
+
+            };
+
+            // Time the thread spends running the work of a task-based region. The threads of such a region take
+            // tasks at barriers instead of finishing their own share, so Leave is given the time they entered plus
+            // Take, and the rest of the region is idle. A task run while another waits on the same thread counts once.
+            class Busy
+            {
+
+                private:
+                    static inline thread_local uint64_t Total   = 0;
+                    static inline thread_local int      Nesting = 0;
+
+                    const uint64_t Begin = Nesting++ == 0 ? Now() : 0;
+
+                public:
+                    ~Busy()
+                    {
+                        if (--Nesting == 0) Total += Now() - Begin;
+                    }
+
+                    // The busy time of this thread since the last Take
+                    static inline uint64_t Take()
+                    {
+                        const uint64_t total = Total;
+                        Total = 0;
+                        return total;
+                    }
+
+            };
+
+            using Phase = PerfCounters::Phase;
+
+            static inline SearchStatTotals Total()
+            {
+                std::lock_guard<std::mutex> guard(SlotLock);
+
+                SearchStatTotals totals;
+                for (const Slot& slot : Slots) for (uint8_t i = 0; i < SearchStatCount; i++)
+                    totals.Counts[i] += slot.Counts[i].load(std::memory_order_relaxed);
+
+                return totals;
+            }
+
+            static inline void Reset()
+            {
+                std::lock_guard<std::mutex> guard(SlotLock);
+
+                for (Slot& slot : Slots) for (std::atomic<uint64_t>& counter : slot.Counts)
+                    counter.store(0, std::memory_order_relaxed);
+            }
+
+    };
+
+    struct NoSearchStats
+    {
+        static constexpr bool Enabled = false;
+
+        static inline void Add(const SearchStat, const uint64_t = 1) {}
+
+        static inline uint64_t Now()
+        {
+            return 0;
+        }
+
+        using Lock = std::lock_guard<std::mutex>;
+
+        struct Region
+        {
+            inline void Enter() const {}
+
+            inline void Leave(const uint64_t) {}
+
+            inline void Close() const {}
+        };
+
+        struct Busy
+        {
+            static inline uint64_t Take()
+            {
+                return 0;
+            }
+        };
+
+        struct Phase
+        {
+            explicit Phase(const SearchPhase) {}
+
+            inline void Stop() {}
+        };
+
+        static inline SearchStatTotals Total()
+        {
+            return {};
+        }
+
+        static inline void Reset() {}
+    };
+
+} // StockDory
+
+#endif //STOCKDORY_SEARCHSTATS_H
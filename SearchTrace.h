@@ -0,0 +1,176 @@
+//
+// Timeline of the parallel searches, compiled in or out by the Engine's Trace policy.
+// SearchTrace records spans (split points, the subtrees searched under them, alpha updates and the waits at the end of
+// a split) with their thread into a ring buffer per thread. Only its own thread writes a ring and nothing is locked
+// while recording, a full ring overwrites its oldest spans. Nothing is recorded, and no clock is read for a span, until
+// Start, which also registers the dump of every ring as Chrome trace-event JSON at exit, to open in Perfetto or
+// chrome://tracing.
+// NoSearchTrace is the default: every span is an empty inline object and the searches compile as without tracing.
+//
+
+#ifndef STOCKDORY_SEARCHTRACE_H
+#define STOCKDORY_SEARCHTRACE_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+
+namespace StockDory
+{
+
+    class SearchTrace
+    {
+
+        private:
+            // Spans per thread kept until the dump
+            static constexpr uint64_t Capacity = 1 << 16;
+
+            struct Span
+            {
+                const char* Name ;
+                uint64_t    Begin;
+                uint64_t    End  ;
+                int32_t     Depth;
+            };
+
+            struct alignas(64) Ring
+            {
+                uint32_t                   Thread;
+                std::atomic<uint64_t>      Head   = 0;
+                std::array<Span, Capacity> Spans ;
+            };
+
+            static inline std::mutex        RingLock ;
+            static inline std::deque<Ring>  Rings    ;
+            static inline std::atomic<bool> Recording = false;
+            static inline uint64_t          Origin    = 0;
+            static inline std::string       Path     ;
+
+            static inline Ring& Register()
+            {
+                std::lock_guard<std::mutex> guard(RingLock);
+                Ring& ring = Rings.emplace_back();
+                ring.Thread = Rings.size() - 1;
+                return ring;
+            }
+
+            static inline Ring& Local()
+            {
+                thread_local Ring& ring = Register();
+                return ring;
+            }
+
+            static inline void Dump()
+            {
+                Recording = false;
+
+                std::lock_guard<std::mutex> guard(RingLock);
+                std::ofstream out(Path);
+                out << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [\n";
+                bool first = true;
+                for (const Ring& ring : Rings) {
+                    out << (first ? "" : ",\n") << "{\"ph\": \"M\", \"name\": \"thread_name\", \"pid\": 1, \"tid\": "
+                        << ring.Thread << ", \"args\": {\"name\": \"search thread " << ring.Thread << "\"}}";
+                    first = false;
+
+                    const uint64_t head = ring.Head.load(std::memory_order_acquire);
+                    for (uint64_t i = head > Capacity ? head - Capacity : 0; i < head; i++) {
+                        const Span& span = ring.Spans[i % Capacity];
+                        out << ",\n{\"ph\": \"X\", \"name\": \"" << span.Name << "\", \"pid\": 1, \"tid\": "
+                            << ring.Thread << ", \"ts\": " << static_cast<double>(span.Begin - Origin) / 1000
+                            << ", \"dur\": " << static_cast<double>(span.End - span.Begin) / 1000;
+                        if (span.Depth >= 0) out << ", \"args\": {\"depth\": " << span.Depth << "}";
+                        out << "}";
+                    }
+                }
+                out << "\n]}\n";
+            }
+
+        public:
+            static constexpr bool Enabled = true;
+
+            static inline uint64_t Now()
+            {
+                return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now().time_since_epoch()).count();
+            }
+
+            // Records from now on and writes the trace to path when the program exits
+            static inline void Start(const std::string& path)
+            {
+                Path   = path;
+                Origin = Now();
+                std::atexit(Dump);
+                Recording = true;
+            }
+
+            static inline bool Active()
+            {
+                return Recording.load(std::memory_order_relaxed);
+            }
+
+            static inline void Record(const char* name, const uint64_t begin, const uint64_t end, const int depth = -1)
+            {
+                if (!Active()) return;
+
+                Ring& ring = Local();
+                const uint64_t head = ring.Head.load(std::memory_order_relaxed);
+                ring.Spans[head % Capacity] = {name, begin, end, depth};
+                ring.Head.store(head + 1, std::memory_order_release);
+            }
+
+            // Records the scope it lives in, without reading the clock when nothing is recorded
+            class Scope
+            {
+
+                private:
+                    const char*    Name ;
+                    const int      Depth;
+                    const bool     Timed = Active();
+                    const uint64_t Begin = Timed ? Now() : 0;
+
+                public:
+                    explicit Scope(const char* name, const int depth = -1) : Name(name), Depth(depth) {}
+
+                    ~Scope()
+                    {
+                        if (Timed) Record(Name, Begin, Now(), Depth);
+                    }
+
+            };
+
+    };
+
+    struct NoSearchTrace
+    {
+        static constexpr bool Enabled = false;
+
+        static inline uint64_t Now()
+        {
+            return 0;
+        }
+
+        static inline void Start(const std::string&) {}
+
+        static constexpr bool Active()
+        {
+            return false;
+        }
+
+        static inline void Record(const char*, const uint64_t, const uint64_t, const int = -1) {}
+
+        struct Scope
+        {
+            explicit Scope(const char*, const int = -1) {}
+        };
+    };
+
+} // StockDory
+
+#endif //STOCKDORY_SEARCHTRACE_H
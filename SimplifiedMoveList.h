@@ -25,21 +25,24 @@ namespace StockDory
         uint8_t Size = 0;
 
     public:
-        explicit SimplifiedMoveList(const Board& board)
+        explicit SimplifiedMoveList(const Board& board) :
+                SimplifiedMoveList(board, board.Attacks<Color>()) {}
+
+        // Searches that also need the check state build the context themselves and hand it in.
+        SimplifiedMoveList(const Board& board, const AttackContext& context)
         {
-            const PinBitBoard   pin   = board.Pin  <Color, Opposite(Color)>();
-            const CheckBitBoard check = board.Check<Opposite(Color)>();
+            const PinBitBoard&   pin   = context.Pin  ;
+            const CheckBitBoard& check = context.Check;
 
-            if (check.DoubleCheck) {
-                AddMoveLoop<King>(board, pin, check);
-            } else {
-                AddMoveLoop<Pawn>(board, pin, check);
+            if (!check.DoubleCheck) {
+                AddPawnMoves(board, pin, check);
                 AddMoveLoop<Knight>(board, pin, check);
                 AddMoveLoop<Bishop>(board, pin, check);
                 AddMoveLoop<Rook>(board, pin, check);
                 AddMoveLoop<Queen>(board, pin, check);
-                AddMoveLoop<King>(board, pin, check);
             }
+
+            AddKingMoves(board, context);
         }
 
         template<Piece Piece>
@@ -70,7 +73,119 @@ namespace StockDory
             }
         }
 
+        inline void AddKingMoves(const Board& board, const AttackContext& context)
+        {
+            const MoveList<King, Color> moves(board, context);
+            BitBoardIterator moveIterator = CaptureOnly ?
+                    moves.Mask(~board[NAC]).Iterator() :
+                    moves.Iterator();
+
+            for (Square m = moveIterator.Value(); m != NASQ; m = moveIterator.Value())
+                Internal[Size++] = CreateMove<King>(context.King, m);
+        }
+
+        // All pawns are generated at once: every kind of pawn move is one shift of the pawn board, masked in bulk by
+        // the pins and the check mask, and each target square gives back its from square by undoing the shift.
+        inline void AddPawnMoves(const Board& board,
+                                 const PinBitBoard& pin,
+                                 const CheckBitBoard& check)
+        {
+            const PawnTargetSet targets = PawnTargets(board, pin, check);
+
+            AddPawnTargets<Forward    >(targets.Push      );
+            AddPawnTargets<Forward * 2>(targets.DoublePush);
+            AddPawnTargets<Forward - 1>(targets.West      );
+            AddPawnTargets<Forward + 1>(targets.East      );
+
+            BitBoardIterator iterator(targets.EnPassant);
+            for (Square sq = iterator.Value(); sq != NASQ; sq = iterator.Value())
+                Internal[Size++] = CreateMove<Pawn>(sq, board.EnPassantSquare());
+        }
+
+        struct PawnTargetSet
+        {
+            BitBoard Push       = BBDefault;
+            BitBoard DoublePush = BBDefault;
+            BitBoard West       = BBDefault;
+            BitBoard East       = BBDefault;
+
+            // From squares, there is only one en passant target.
+            BitBoard EnPassant  = BBDefault;
+        };
+
+        static inline PawnTargetSet PawnTargets(const Board& board,
+                                                const PinBitBoard& pin,
+                                                const CheckBitBoard& check)
+        {
+            PawnTargetSet targets = PawnTargetSet();
+
+            const BitBoard pawns = board.PieceBoard<Color>(Pawn);
+
+            // Straight pinned pawns can only push along their pin, diagonally pinned ones can only capture along it.
+            if (!CaptureOnly) {
+                const BitBoard pushers = pawns & ~pin.Diagonal;
+                const BitBoard single  = (Shift<Forward>(pushers & ~pin.Straight) |
+                                          (Shift<Forward>(pushers &  pin.Straight) & pin.Straight)) & board[NAC];
+
+                targets.Push       = single & check.Check;
+                targets.DoublePush = Shift<Forward>(single & DoublePushRank) & board[NAC] & check.Check;
+            }
+
+            const BitBoard capturers = pawns & ~pin.Straight;
+            const BitBoard west      = capturers & ~BlackMagicFactory::Horizontal[0];
+            const BitBoard east      = capturers & ~BlackMagicFactory::Horizontal[7];
+            const BitBoard enemy     = board[Opposite(Color)] & check.Check;
+
+            targets.West = (Shift<Forward - 1>(west & ~pin.Diagonal) |
+                            (Shift<Forward - 1>(west &  pin.Diagonal) & pin.Diagonal)) & enemy;
+            targets.East = (Shift<Forward + 1>(east & ~pin.Diagonal) |
+                            (Shift<Forward + 1>(east &  pin.Diagonal) & pin.Diagonal)) & enemy;
+
+            // At most two pawns can take en passant, so they keep the per-pawn legality test. Like the per-square
+            // generator, the capture is not limited by the check mask.
+            const Square epTarget = board.EnPassantSquare();
+            if (epTarget == NASQ) return targets;
+
+            const auto epPieceSq = static_cast<Square>(epTarget - Forward);
+            BitBoardIterator iterator(AttackTable::Pawn[Opposite(Color)][epTarget] & capturers);
+            for (Square sq = iterator.Value(); sq != NASQ; sq = iterator.Value()) {
+                if (Get(pin.Diagonal, sq) && !Get(pin.Diagonal, epTarget)) continue;
+                if (!MoveList<Pawn, Color>::EnPassantLegal(board, sq, epPieceSq, epTarget)) continue;
+
+                Set<true>(targets.EnPassant, sq);
+            }
+
+            return targets;
+        }
+
     private:
+        static constexpr int      Forward        = Color == White ? 8 : -8;
+        static constexpr BitBoard DoublePushRank = BlackMagicFactory::Vertical[Color == White ? 2 : 5];
+        static constexpr BitBoard PromotionRank  = BlackMagicFactory::Vertical[Color == White ? 7 : 0];
+
+        template<int Offset>
+        static constexpr inline BitBoard Shift(const BitBoard bb)
+        {
+            return Offset > 0 ? bb << Offset : bb >> -Offset;
+        }
+
+        template<int Offset>
+        inline void AddPawnTargets(const BitBoard targets)
+        {
+            BitBoardIterator iterator(targets & ~PromotionRank);
+            for (Square m = iterator.Value(); m != NASQ; m = iterator.Value())
+                Internal[Size++] = CreateMove<Pawn>(static_cast<Square>(m - Offset), m);
+
+            iterator = BitBoardIterator(targets & PromotionRank);
+            for (Square m = iterator.Value(); m != NASQ; m = iterator.Value()) {
+                const auto sq = static_cast<Square>(m - Offset);
+                Internal[Size++] = CreateMove<Pawn, Queen>(sq, m);
+                Internal[Size++] = CreateMove<Pawn, Knight>(sq, m);
+                Internal[Size++] = CreateMove<Pawn, Rook>(sq, m);
+                Internal[Size++] = CreateMove<Pawn, Bishop>(sq, m);
+            }
+        }
+
         template<Piece Piece, enum Piece Promotion = NAP>
         inline Move CreateMove(const Square from, const Square to)
         {
@@ -93,6 +208,45 @@ namespace StockDory
 
     };
 
+    template<Piece Piece, Color Color>
+    inline bool HasPieceMove(const Board& board, const PinBitBoard& pin, const CheckBitBoard& check)
+    {
+        BitBoardIterator iterator(board.PieceBoard<Color>(Piece));
+
+        for (Square sq = iterator.Value(); sq != NASQ; sq = iterator.Value())
+            if (MoveList<Piece, Color>(board, sq, pin, check).Count()) return true;
+
+        return false;
+    }
+
+    // Mate and stalemate tests only need to know whether one legal move exists, so this stops at the first one. King
+    // moves come first, they need nothing but the attack map and are the likeliest to exist. Castling never has to be
+    // looked at, it needs the king's step towards the rook to be legal already.
+    template<Color Color>
+    inline bool HasLegalMove(const Board& board, const AttackContext& context)
+    {
+        if (AttackTable::King[context.King] & ~board[Color] & ~context.Threats) return true;
+
+        if (context.Check.DoubleCheck) return false;
+
+        const PinBitBoard&   pin   = context.Pin  ;
+        const CheckBitBoard& check = context.Check;
+
+        const auto pawns = SimplifiedMoveList<Color>::PawnTargets(board, pin, check);
+        if (pawns.Push | pawns.DoublePush | pawns.West | pawns.East | pawns.EnPassant) return true;
+
+        return HasPieceMove<Knight, Color>(board, pin, check) ||
+               HasPieceMove<Bishop, Color>(board, pin, check) ||
+               HasPieceMove<Rook  , Color>(board, pin, check) ||
+               HasPieceMove<Queen , Color>(board, pin, check);
+    }
+
+    template<Color Color>
+    inline bool HasLegalMove(const Board& board)
+    {
+        return HasLegalMove<Color>(board, board.Attacks<Color>());
+    }
+
 } // StockDory
 
 #endif //STOCKDORY_SIMPLIFIEDMOVELIST_H
@@ -0,0 +1,272 @@
+//
+// Where the OpenMP threads of the searches run. Without a placement the team is left to the OS, which at 32 to 64
+// threads scatters it over sockets and SMT siblings and moves it around between searches.
+//   System         no pinning, every thread may run on any CPU the process was started with
+//   Compact        thread after thread on neighbouring logical CPUs, SMT siblings first, then cores, then sockets
+//   Scatter        round robin over the sockets (NUMA nodes), then over their cores, SMT siblings last
+//   PhysicalCores  one thread per physical core, in compact order, SMT siblings only once every core has a thread
+//   NumaLocal      the threads split into equal blocks over the NUMA nodes, each free to run on any CPU of its node
+// PlaceThreads sets the team size and pins every thread of it from inside a parallel region, so the pool threads
+// that run the next regions keep their CPU. The searches allocate their per-thread boards, statistics slots and split
+// points from the thread that uses them, so once pinned they are first touched, and stay, on the thread's own node.
+// The topology is read from /sys on Linux. Without /sys every CPU counts as its own core on a single node, and off
+// Linux nothing is pinned.
+//
+
+#ifndef STOCKDORY_THREADPLACEMENT_H
+#define STOCKDORY_THREADPLACEMENT_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <omp.h>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace StockDory
+{
+
+    enum class Placement : uint8_t
+    {
+        System       ,
+        Compact      ,
+        Scatter      ,
+        PhysicalCores,
+        NumaLocal    ,
+        PlacementCount
+    };
+
+    // Names for configs and reports, in Placement order.
+    constexpr std::array<const char*, static_cast<size_t>(Placement::PlacementCount)> PlacementNames = {
+        "system", "compact", "scatter", "cores", "numa"
+    };
+
+    struct LogicalCpu
+    {
+        int Cpu    ;
+        int Core   ; // core_id, only unique within the package
+        int Package;
+        int Node   ;
+        int Sibling; // 0 for the first hardware thread of its core, 1 for the second...
+    };
+
+    class Topology
+    {
+
+        private:
+            std::vector<LogicalCpu> Cpus;
+            int Packages = 1;
+            int Nodes    = 1;
+            int Cores    = 0;
+
+            // "0-3,8,10-11"
+            static std::vector<int> ParseList(const std::string& list)
+            {
+                std::vector<int> values;
+                std::stringstream stream(list);
+                std::string item;
+                while (std::getline(stream, item, ',')) {
+                    if (item.empty() || item == "\n") continue;
+
+                    const size_t dash = item.find('-');
+                    const int    first = std::stoi(item.substr(0, dash));
+                    const int    last  = dash == std::string::npos ? first : std::stoi(item.substr(dash + 1));
+                    for (int v = first; v <= last; v++) values.push_back(v);
+                }
+
+                return values;
+            }
+
+            static bool ReadLine(const std::string& path, std::string& line)
+            {
+                std::ifstream file(path);
+                return file && std::getline(file, line);
+            }
+
+            static bool ReadInt(const std::string& path, int& value)
+            {
+                std::string line;
+                if (!ReadLine(path, line)) return false;
+
+                value = std::stoi(line);
+                return true;
+            }
+
+            // CPUs in compact order: node, package, core, sibling
+            static bool CompactOrder(const LogicalCpu& a, const LogicalCpu& b)
+            {
+                return std::tie(a.Node, a.Package, a.Core, a.Sibling) < std::tie(b.Node, b.Package, b.Core, b.Sibling);
+            }
+
+        public:
+            static Topology Detect()
+            {
+                Topology topology;
+
+                std::string online;
+                std::vector<int> cpus;
+                if (ReadLine("/sys/devices/system/cpu/online", online)) cpus = ParseList(online);
+                if (cpus.empty()) for (int cpu = 0; cpu < static_cast<int>(std::max(1u, std::thread::hardware_concurrency())); cpu++)
+                    cpus.push_back(cpu);
+
+#ifdef __linux__
+                // Only the CPUs the process may run on (a container or taskset may allow fewer than are online)
+                cpu_set_t allowed;
+                if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0)
+                    cpus.erase(std::remove_if(cpus.begin(), cpus.end(), [&](const int cpu) {
+                        return !CPU_ISSET(cpu, &allowed);
+                    }), cpus.end());
+#endif
+
+                std::vector<int> nodeOf(*std::max_element(cpus.begin(), cpus.end()) + 1, 0);
+                std::string nodeList;
+                for (int node = 0; ReadLine("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist", nodeList); node++) {
+                    for (const int cpu : ParseList(nodeList)) if (cpu < static_cast<int>(nodeOf.size())) nodeOf[cpu] = node;
+                    topology.Nodes = node + 1;
+                }
+
+                for (const int cpu : cpus) {
+                    const std::string path = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/";
+                    LogicalCpu logical = {cpu, cpu, 0, nodeOf[cpu], 0};
+                    ReadInt(path + "core_id", logical.Core);
+                    ReadInt(path + "physical_package_id", logical.Package);
+                    topology.Cpus.push_back(logical);
+                }
+
+                std::sort(topology.Cpus.begin(), topology.Cpus.end(), CompactOrder);
+                for (size_t i = 0; i < topology.Cpus.size(); i++) {
+                    LogicalCpu& cpu = topology.Cpus[i];
+                    if (i > 0 && cpu.Package == topology.Cpus[i - 1].Package && cpu.Core == topology.Cpus[i - 1].Core) {
+                        cpu.Sibling = topology.Cpus[i - 1].Sibling + 1;
+                    } else {
+                        topology.Cores++;
+                    }
+                    topology.Packages = std::max(topology.Packages, cpu.Package + 1);
+                }
+
+                return topology;
+            }
+
+            // The CPUs every thread of a team of the given size may run on, empty for a thread that is not pinned
+            [[nodiscard]]
+            std::vector<std::vector<int>> Assign(const Placement placement, const int threads) const
+            {
+                std::vector<std::vector<int>> assigned(threads);
+                if (placement == Placement::System || Cpus.empty()) return assigned;
+
+                if (placement == Placement::NumaLocal) {
+                    // memory-only nodes get no threads
+                    std::vector<int> nodes;
+                    for (const LogicalCpu& cpu : Cpus) if (nodes.empty() || nodes.back() != cpu.Node) nodes.push_back(cpu.Node);
+
+                    for (int t = 0; t < threads; t++) {
+                        const int node = nodes[t * nodes.size() / threads];
+                        for (const LogicalCpu& cpu : Cpus) if (cpu.Node == node) assigned[t].push_back(cpu.Cpu);
+                    }
+                    return assigned;
+                }
+
+                std::vector<LogicalCpu> order = Cpus;
+                if (placement == Placement::Scatter) {
+                    // the n-th core of every node before the (n + 1)-th of any, the second SMT siblings after all cores
+                    std::vector<int> rank(order.size());
+                    std::vector<int> seen(Nodes, 0);
+                    for (size_t i = 0; i < order.size(); i++) if (order[i].Sibling == 0) rank[i] = seen[order[i].Node]++;
+                    for (size_t i = 0; i < order.size(); i++) if (order[i].Sibling != 0) rank[i] = rank[i - order[i].Sibling];
+
+                    std::vector<size_t> index(order.size());
+                    for (size_t i = 0; i < index.size(); i++) index[i] = i;
+                    std::stable_sort(index.begin(), index.end(), [&](const size_t a, const size_t b) {
+                        return std::tie(order[a].Sibling, rank[a], order[a].Node) <
+                               std::tie(order[b].Sibling, rank[b], order[b].Node);
+                    });
+
+                    std::vector<LogicalCpu> scattered;
+                    for (const size_t i : index) scattered.push_back(order[i]);
+                    order = scattered;
+                } else if (placement == Placement::PhysicalCores) {
+                    std::stable_sort(order.begin(), order.end(), [](const LogicalCpu& a, const LogicalCpu& b) {
+                        return a.Sibling < b.Sibling;
+                    });
+                }
+
+                // more threads than CPUs wrap around
+                for (int t = 0; t < threads; t++) assigned[t].push_back(order[t % order.size()].Cpu);
+                return assigned;
+            }
+
+            [[nodiscard]]
+            const std::vector<LogicalCpu>& Logical() const
+            {
+                return Cpus;
+            }
+
+            [[nodiscard]]
+            std::string Describe() const
+            {
+                std::stringstream description;
+                description << Packages << (Packages == 1 ? " package, " : " packages, ") << Nodes
+                            << (Nodes == 1 ? " NUMA node, " : " NUMA nodes, ") << Cores << " cores, " << Cpus.size()
+                            << " logical CPUs";
+                return description.str();
+            }
+
+    };
+
+    // The CPU sets of a team, one per thread as "{0,1}", for reports
+    inline std::string DescribeAssignment(const std::vector<std::vector<int>>& assigned)
+    {
+        std::stringstream description;
+        for (size_t t = 0; t < assigned.size(); t++) {
+            description << (t ? " " : "");
+            if (assigned[t].empty()) {
+                description << "*";
+                continue;
+            }
+
+            description << "{";
+            for (size_t i = 0; i < assigned[t].size(); i++) description << (i ? "," : "") << assigned[t][i];
+            description << "}";
+        }
+
+        return description.str();
+    }
+
+    // Sets the team size of the next parallel regions and pins its threads, returns the CPUs each thread got
+    inline std::vector<std::vector<int>> PlaceThreads(const Topology& topology, const Placement placement, const int threads)
+    {
+        const std::vector<std::vector<int>> assigned = topology.Assign(placement, threads);
+
+        //a team of exactly this size, so thread t of every region is the pool thread pinned as t here
+        omp_set_dynamic(0);
+        omp_set_num_threads(threads);
+
+#ifdef __linux__
+        #pragma omp parallel num_threads(threads)
+        {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            const std::vector<int>& cpus = assigned[omp_get_thread_num()];
+            // an unpinned thread gets every CPU the process started with back, undoing an earlier placement
+            if (cpus.empty()) for (const LogicalCpu& cpu : topology.Logical()) CPU_SET(cpu.Cpu, &set);
+            else for (const int cpu : cpus) CPU_SET(cpu, &set);
+            pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+        }
+#endif
+
+        return assigned;
+    }
+
+} // StockDory
+
+#endif //STOCKDORY_THREADPLACEMENT_H
@@ -0,0 +1,502 @@
+// bench.cpp
+// Runs the search benchmarks from files instead of hardcoded lists, so scaling studies on new hardware need no rebuild.
+// Usage: bench <suite.epd> <matrix.cfg> [--csv <file>] [--json <file>] [--trace <file>] [--perf]
+//   suite.epd   one position per line, EPD (four FEN fields and operations) or a full FEN, an `id "..."` names it
+//   matrix.cfg  key = value lines, # starts a comment:
+//                 algorithms  = minimax, parallelMinimax, alphaBeta, naive, naivePV, YBWC, PVS, alphaBetaParallel,
+//                               ABDADA, DTS, YBWCTask
+//                 depths      = 5-6          (a list, ranges allowed)
+//                 threads     = 1, 2, 4, 8   (sequential algorithms only run with 1)
+//                 repetitions = 20
+//                 warmup      = 1            (untimed runs before each cell, 0 by default)
+//                 placement   = compact      (system, compact, scatter, cores or numa, see ThreadPlacement.h;
+//                                             system by default)
+// The machine's topology is printed first, with the CPUs every thread count of the matrix is pinned to.
+// Every (position, algorithm, depth, threads) cell is timed over the repetitions and reported with the median,
+// minimum, mean and standard deviation of the times, the nodes per second at the median time, the best move and its
+// score (from the view of the side to move, for every algorithm) and the statistics of one search (see SearchStats.h,
+// averaged over the repetitions): nodes, leaf evaluations, hash probes and hits, beta cutoffs and how many of them the
+// first move caused, splits, aborts and critical sections.
+// Every cell is also held against the sequential alphaBeta at the same position and depth, which is run once for them
+// (or taken from the matrix when it lists alphaBeta): the speedup over its median time and the three parallel
+// overheads, the extra nodes searched (search overhead) and the share of the threads' time spent synchronizing (fork,
+// locks and joins) and idle (waiting at the end of a region or for a split point). They are printed as a table after
+// the cells of each depth.
+// --trace writes the timeline of the splits of every parallel search run (see SearchTrace.h) as Chrome trace-event JSON,
+// for Perfetto. Give it a matrix of one or a few cells, the rings only keep the latest spans of every thread.
+// --perf reads the hardware counters of every search thread around move generation, make/unmake, evaluation and hash
+// probes (see PerfCounters.h) and prints the IPC and the cycles and misses per node of each phase. Counting makes the
+// searches much slower, so a --perf run is for the counters and its times are not comparable to other runs.
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+#include <cstdint>
+#include <omp.h>
+#include "Backend/Board.h"
+#include "Backend/Type/Color.h"
+#include "SearchStats.h"
+#include "SearchTrace.h"
+#include "ThreadPlacement.h"
+#include "Engine.h"
+
+constexpr int maxDepth = 25;
+
+//the bench is the one program that builds the searches with their statistics counted and their splits traced
+using BenchEngine = Engine<StockDory::DefaultMakePolicy, StockDory::SearchStats, StockDory::SearchTrace>;
+
+enum class Algorithm {
+    Minimax, ParallelMinimax, AlphaBeta, Naive, NaivePV, YBWC, PVS, AlphaBetaParallel, ABDADA, DTS, YBWCTask
+};
+
+struct AlgorithmInfo {
+    const char* key;
+    Algorithm algorithm;
+    bool parallel;
+};
+
+const AlgorithmInfo algorithms[] = {
+    {"minimax",           Algorithm::Minimax,           false},
+    {"parallelMinimax",   Algorithm::ParallelMinimax,   true },
+    {"alphaBeta",         Algorithm::AlphaBeta,         false},
+    {"naive",             Algorithm::Naive,             true },
+    {"naivePV",           Algorithm::NaivePV,           true },
+    {"YBWC",              Algorithm::YBWC,              true },
+    {"PVS",               Algorithm::PVS,               true },
+    {"alphaBetaParallel", Algorithm::AlphaBetaParallel, true },
+    {"ABDADA",            Algorithm::ABDADA,            true },
+    {"DTS",               Algorithm::DTS,               true },
+    {"YBWCTask",          Algorithm::YBWCTask,          true }
+};
+
+struct Position {
+    std::string id;
+    std::string fen;
+};
+
+struct Matrix {
+    std::vector<const AlgorithmInfo*> algorithms;
+    std::vector<int> depths;
+    std::vector<int> threads = {1};
+    int repetitions = 1;
+    int warmup = 0;
+    StockDory::Placement placement = StockDory::Placement::System;
+};
+
+struct Cell {
+    const Position* position;
+    const AlgorithmInfo* algorithm;
+    int depth;
+    int threads;
+    int repetitions;
+    const char* placement;
+    std::string cpus;
+    double median = 0, min = 0, mean = 0, stddev = 0;
+    uint64_t nodes = 0;
+    double nps = 0;
+    StockDory::SearchStatTotals stats = {};
+    StockDory::PerfTotals perf = {};
+    std::string bestMove = {};
+    int score = 0;
+    // against the sequential alphaBeta, the shares are of the threads' total time
+    double speedup = 0, searchOverhead = 0, syncShare = 0, idleShare = 0;
+};
+
+std::string trim(const std::string &s) {
+    size_t begin = s.find_first_not_of(" \t\r");
+    size_t end = s.find_last_not_of(" \t\r");
+    return begin == std::string::npos ? "" : s.substr(begin, end - begin + 1);
+}
+
+std::vector<std::string> splitList(const std::string &s) {
+    std::vector<std::string> items;
+    std::stringstream stream(s);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        item = trim(item);
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+// "1, 2, 4" or "5-6" or a mix of both
+std::vector<int> parseIntegers(const std::string &s) {
+    std::vector<int> values;
+    for (const std::string &item : splitList(s)) {
+        size_t dash = item.find('-', 1);
+        if (dash == std::string::npos) {
+            values.push_back(std::stoi(item));
+        } else {
+            for (int v = std::stoi(item.substr(0, dash)); v <= std::stoi(item.substr(dash + 1)); v++) {
+                values.push_back(v);
+            }
+        }
+    }
+    return values;
+}
+
+bool readSuite(const std::string &path, std::vector<Position> &positions) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "Error: Unable to open " << path << "\n";
+        return false;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        line = trim(line);
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::stringstream stream(line);
+        std::vector<std::string> fields;
+        std::string field;
+        for (int i = 0; i < 6 && stream >> field; i++) {
+            fields.push_back(field);
+        }
+        if (fields.size() < 4) {
+            std::cerr << "Error: Not a position: " << line << "\n";
+            return false;
+        }
+        // EPD leaves out the move counters, a full FEN has them as fields five and six
+        bool counters = fields.size() == 6 &&
+                        std::all_of(fields[4].begin(), fields[4].end(), ::isdigit) &&
+                        std::all_of(fields[5].begin(), fields[5].end(), ::isdigit);
+        Position position;
+        position.fen = fields[0] + " " + fields[1] + " " + fields[2] + " " + fields[3] +
+                       (counters ? " " + fields[4] + " " + fields[5] : " 0 1");
+        size_t id = line.find("id \"");
+        if (id != std::string::npos) {
+            position.id = line.substr(id + 4, line.find('"', id + 4) - id - 4);
+        } else {
+            position.id = std::to_string(positions.size() + 1);
+        }
+        positions.push_back(position);
+    }
+    return true;
+}
+
+bool readMatrix(const std::string &path, Matrix &matrix) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "Error: Unable to open " << path << "\n";
+        return false;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        line = trim(line.substr(0, line.find('#')));
+        if (line.empty()) {
+            continue;
+        }
+        size_t equals = line.find('=');
+        if (equals == std::string::npos) {
+            std::cerr << "Error: Expected key = value: " << line << "\n";
+            return false;
+        }
+        std::string key = trim(line.substr(0, equals));
+        std::string value = trim(line.substr(equals + 1));
+        if (key == "algorithms") {
+            for (const std::string &name : splitList(value)) {
+                auto info = std::find_if(std::begin(algorithms), std::end(algorithms),
+                                         [&](const AlgorithmInfo &a) { return name == a.key; });
+                if (info == std::end(algorithms)) {
+                    std::cerr << "Error: Unknown algorithm: " << name << "\n";
+                    return false;
+                }
+                matrix.algorithms.push_back(info);
+            }
+        } else if (key == "depths") {
+            matrix.depths = parseIntegers(value);
+        } else if (key == "threads") {
+            matrix.threads = parseIntegers(value);
+        } else if (key == "repetitions") {
+            matrix.repetitions = std::stoi(value);
+        } else if (key == "warmup") {
+            matrix.warmup = std::stoi(value);
+        } else if (key == "placement") {
+            auto name = std::find(StockDory::PlacementNames.begin(), StockDory::PlacementNames.end(), value);
+            if (name == StockDory::PlacementNames.end()) {
+                std::cerr << "Error: Unknown placement: " << value << "\n";
+                return false;
+            }
+            matrix.placement = static_cast<StockDory::Placement>(name - StockDory::PlacementNames.begin());
+        } else {
+            std::cerr << "Error: Unknown key: " << key << "\n";
+            return false;
+        }
+    }
+    if (matrix.algorithms.empty() || matrix.depths.empty() || matrix.repetitions < 1) {
+        std::cerr << "Error: " << path << " needs algorithms, depths and a positive repetitions\n";
+        return false;
+    }
+    return true;
+}
+
+template<Color color>
+std::pair<std::array<Move, maxDepth>, int> search(BenchEngine &engine, Algorithm algorithm, StockDory::Board &board, int depth) {
+    switch (algorithm) {
+        case Algorithm::Minimax:           return engine.minimax<color, maxDepth>(board, depth);
+        case Algorithm::ParallelMinimax:   return engine.parallelMinimax<color, maxDepth>(board, depth);
+        case Algorithm::AlphaBeta:         return engine.alphaBetaNega<color, maxDepth>(board, -50000, 50000, depth);
+        case Algorithm::Naive:             return engine.naiveParallelAlphaBeta<color, maxDepth>(board, -50000, 50000, depth);
+        case Algorithm::NaivePV:           return engine.naiveParallelPVAlphaBeta<color, maxDepth>(board, -50000, 50000, depth);
+        case Algorithm::YBWC:              return engine.YBWC<color, maxDepth>(board, -50000, 50000, depth);
+        case Algorithm::PVS:               return engine.PVS<color, maxDepth>(board, -50000, 50000, depth);
+        case Algorithm::AlphaBetaParallel: return engine.alphaBetaNegaParallel<color, maxDepth>(board, -50000, 50000, depth);
+        case Algorithm::ABDADA:            return engine.ABDADA<color, maxDepth>(board, -50000, 50000, depth);
+        case Algorithm::DTS:               return engine.DTS<color, maxDepth>(board, -50000, 50000, depth);
+        case Algorithm::YBWCTask:          return engine.YBWCTask<color, maxDepth>(board, -50000, 50000, depth);
+    }
+    return {};
+}
+
+Cell runCell(BenchEngine &engine, const StockDory::Topology &topology, const Position &position, const AlgorithmInfo &algorithm, int depth, int threads, const Matrix &matrix) {
+    std::string cpus = StockDory::DescribeAssignment(StockDory::PlaceThreads(topology, matrix.placement, threads));
+    StockDory::Board board(position.fen);
+    auto run = [&]() {
+        return board.ColorToMove() == White ? search<White>(engine, algorithm.algorithm, board, depth)
+                                            : search<Black>(engine, algorithm.algorithm, board, depth);
+    };
+    //every run starts from an empty hash table, outside the timing, so the repetitions search the same tree
+    for (int i = 0; i < matrix.warmup; i++) {
+        engine.clearHash();
+        run();
+    }
+
+    std::vector<double> times;
+    std::pair<std::array<Move, maxDepth>, int> result;
+    StockDory::SearchStats::Reset();
+    StockDory::PerfCounters::Reset();
+    for (int i = 0; i < matrix.repetitions; i++) {
+        engine.clearHash();
+        double tstart = omp_get_wtime();
+        result = run();
+        times.push_back(omp_get_wtime() - tstart);
+    }
+    StockDory::SearchStatTotals stats = StockDory::SearchStats::Total();
+    for (uint64_t &count : stats.Counts) {
+        count /= matrix.repetitions;
+    }
+    StockDory::PerfTotals perf = StockDory::PerfCounters::Total();
+    for (auto &phase : perf.Counts) {
+        for (uint64_t &count : phase) {
+            count /= matrix.repetitions;
+        }
+    }
+    uint64_t nodes = stats[StockDory::StatNodes];
+
+    Cell cell{&position, &algorithm, depth, threads, matrix.repetitions,
+              StockDory::PlacementNames[static_cast<size_t>(matrix.placement)], cpus};
+    std::vector<double> sorted = times;
+    std::sort(sorted.begin(), sorted.end());
+    size_t n = sorted.size();
+    cell.median = n % 2 ? sorted[n / 2] : (sorted[n / 2 - 1] + sorted[n / 2]) / 2;
+    cell.min = sorted.front();
+    cell.mean = std::accumulate(times.begin(), times.end(), 0.0) / n;
+    double variance = 0;
+    for (double t : times) {
+        variance += (t - cell.mean) * (t - cell.mean);
+    }
+    cell.stddev = std::sqrt(variance / n);
+    cell.nodes = nodes;
+    cell.nps = cell.median > 0 ? nodes / cell.median : 0;
+    cell.stats = stats;
+    cell.perf = perf;
+    Move best = result.first[0];
+    cell.bestMove = StockDory::Util::SquareToString(best.From()) + StockDory::Util::SquareToString(best.To());
+    //minimax and parallelMinimax score from White's view, the others from the side to move's
+    bool whiteView = algorithm.algorithm == Algorithm::Minimax || algorithm.algorithm == Algorithm::ParallelMinimax;
+    cell.score = whiteView && board.ColorToMove() == Black ? -result.second : result.second;
+    return cell;
+}
+
+void compareToSequential(Cell &cell, const Cell &sequential) {
+    cell.speedup = cell.median > 0 ? sequential.median / cell.median : 0;
+    cell.searchOverhead = sequential.nodes ? static_cast<double>(cell.nodes) / sequential.nodes - 1 : 0;
+    double threadTime = cell.threads * cell.mean * 1e9;
+    cell.syncShare = threadTime > 0 ? cell.stats[StockDory::StatSyncNanoseconds] / threadTime : 0;
+    cell.idleShare = threadTime > 0 ? cell.stats[StockDory::StatIdleNanoseconds] / threadTime : 0;
+}
+
+void printOverheads(const std::vector<Cell> &cells, size_t first, int depth) {
+    std::cout << "  overheads at depth " << depth << " against sequential alphaBeta\n"
+              << "    " << std::left << std::setw(18) << "algorithm" << std::right << std::setw(8) << "threads"
+              << std::setw(10) << "speedup" << std::setw(10) << "search" << std::setw(10) << "sync"
+              << std::setw(10) << "idle" << "\n";
+    for (size_t i = first; i < cells.size(); i++) {
+        const Cell &c = cells[i];
+        std::cout << "    " << std::left << std::setw(18) << c.algorithm->key << std::right << std::setw(8)
+                  << c.threads << std::fixed << std::setprecision(2) << std::setw(10) << c.speedup
+                  << std::setprecision(1) << std::setw(9) << c.searchOverhead * 100 << "%" << std::setw(9)
+                  << c.syncShare * 100 << "%" << std::setw(9) << c.idleShare * 100 << "%\n";
+    }
+}
+
+void printPerf(const Cell &cell) {
+    double nodes = std::max<uint64_t>(cell.nodes, 1);
+    for (uint8_t i = 0; i < StockDory::SearchPhaseCount; i++) {
+        auto phase = static_cast<StockDory::SearchPhase>(i);
+        std::cout << "    " << std::left << std::setw(12) << StockDory::SearchPhaseNames[i] << std::right
+                  << std::fixed << std::setprecision(2) << " ipc " << cell.perf.IPC(phase) << " per node: cycles "
+                  << cell.perf(phase, StockDory::PerfCycles) / nodes << " l1d misses "
+                  << cell.perf(phase, StockDory::PerfL1DMisses) / nodes << " llc misses "
+                  << cell.perf(phase, StockDory::PerfLLCMisses) / nodes << " branch misses "
+                  << cell.perf(phase, StockDory::PerfBranchMisses) / nodes << "\n";
+    }
+}
+
+void writeCsv(std::ostream &out, const std::vector<Cell> &cells) {
+    out << "position,fen,algorithm,depth,threads,repetitions,placement,cpus,median_s,min_s,mean_s,stddev_s,nodes,nps,best_move,score";
+    for (uint8_t i = StockDory::StatLeafEvals; i < StockDory::SearchStatCount; i++) {
+        out << "," << StockDory::SearchStatNames[i];
+    }
+    out << ",first_move_cutoff_rate,speedup,search_overhead,sync_share,idle_share";
+    for (const char* phase : StockDory::SearchPhaseNames) {
+        for (const char* counter : StockDory::PerfCounterNames) {
+            out << "," << phase << "_" << counter;
+        }
+    }
+    out << "\n";
+    out << std::setprecision(9);
+    for (const Cell &c : cells) {
+        out << c.position->id << "," << c.position->fen << "," << c.algorithm->key << "," << c.depth << ","
+            << c.threads << "," << c.repetitions << "," << c.placement << ",\"" << c.cpus << "\"," << c.median << "," << c.min << "," << c.mean << ","
+            << c.stddev << "," << c.nodes << "," << static_cast<uint64_t>(c.nps) << "," << c.bestMove << ","
+            << c.score;
+        for (uint8_t i = StockDory::StatLeafEvals; i < StockDory::SearchStatCount; i++) {
+            out << "," << c.stats.Counts[i];
+        }
+        out << "," << c.stats.FirstMoveCutoffRate() << "," << c.speedup << "," << c.searchOverhead << ","
+            << c.syncShare << "," << c.idleShare;
+        for (const auto &phase : c.perf.Counts) {
+            for (uint64_t count : phase) {
+                out << "," << count;
+            }
+        }
+        out << "\n";
+    }
+}
+
+void writeJson(std::ostream &out, const std::vector<Cell> &cells) {
+    out << "[\n" << std::setprecision(9);
+    for (size_t i = 0; i < cells.size(); i++) {
+        const Cell &c = cells[i];
+        out << "  {\"position\": \"" << c.position->id << "\", \"fen\": \"" << c.position->fen
+            << "\", \"algorithm\": \"" << c.algorithm->key << "\", \"depth\": " << c.depth
+            << ", \"threads\": " << c.threads << ", \"repetitions\": " << c.repetitions
+            << ", \"placement\": \"" << c.placement << "\", \"cpus\": \"" << c.cpus
+            << "\", \"median_s\": " << c.median << ", \"min_s\": " << c.min << ", \"mean_s\": " << c.mean
+            << ", \"stddev_s\": " << c.stddev << ", \"nodes\": " << c.nodes
+            << ", \"nps\": " << static_cast<uint64_t>(c.nps) << ", \"best_move\": \"" << c.bestMove
+            << "\", \"score\": " << c.score;
+        for (uint8_t j = StockDory::StatLeafEvals; j < StockDory::SearchStatCount; j++) {
+            out << ", \"" << StockDory::SearchStatNames[j] << "\": " << c.stats.Counts[j];
+        }
+        out << ", \"first_move_cutoff_rate\": " << c.stats.FirstMoveCutoffRate() << ", \"speedup\": " << c.speedup
+            << ", \"search_overhead\": " << c.searchOverhead << ", \"sync_share\": " << c.syncShare
+            << ", \"idle_share\": " << c.idleShare;
+        for (uint8_t p = 0; p < StockDory::SearchPhaseCount; p++) {
+            for (uint8_t k = 0; k < StockDory::PerfCounterCount; k++) {
+                out << ", \"" << StockDory::SearchPhaseNames[p] << "_" << StockDory::PerfCounterNames[k] << "\": "
+                    << c.perf.Counts[p][k];
+            }
+        }
+        out << "}"
+            << (i + 1 == cells.size() ? "\n" : ",\n");
+    }
+    out << "]\n";
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cerr << "Usage: " << argv[0] << " <suite.epd> <matrix.cfg> [--csv <file>] [--json <file>] [--trace <file>] [--perf]\n";
+        return 1;
+    }
+    std::map<std::string, std::string> outputs;
+    bool perf = false;
+    for (int i = 3; i < argc; i++) {
+        if (std::string(argv[i]) == "--perf") {
+            perf = true;
+        } else if (i + 1 < argc) {
+            outputs[argv[i]] = argv[i + 1];
+            i++;
+        }
+    }
+
+    std::vector<Position> positions;
+    Matrix matrix;
+    if (!readSuite(argv[1], positions) || !readMatrix(argv[2], matrix)) {
+        return 1;
+    }
+
+    if (outputs.count("--trace")) {
+        StockDory::SearchTrace::Start(outputs["--trace"]);
+    }
+    if (perf && !StockDory::PerfCounters::Start()) {
+        std::cerr << "Warning: perf_event_open is not available here, running without hardware counters\n";
+    }
+
+    StockDory::Topology topology = StockDory::Topology::Detect();
+    const char* placement = StockDory::PlacementNames[static_cast<size_t>(matrix.placement)];
+    std::cout << "Topology: " << topology.Describe() << "\n";
+    for (int threads : matrix.threads) {
+        std::cout << "Placement " << placement << ", " << threads << " threads: "
+                  << StockDory::DescribeAssignment(topology.Assign(matrix.placement, threads)) << "\n";
+    }
+
+    BenchEngine engine;
+    const AlgorithmInfo &alphaBeta = *std::find_if(std::begin(algorithms), std::end(algorithms),
+                                                   [](const AlgorithmInfo &a) { return a.algorithm == Algorithm::AlphaBeta; });
+    std::vector<Cell> cells;
+    for (const Position &position : positions) {
+        std::cout << "Position " << position.id << ": " << position.fen << "\n";
+        for (int depth : matrix.depths) {
+            const Cell sequential = runCell(engine, topology, position, alphaBeta, depth, 1, matrix);
+            size_t first = cells.size();
+            for (const AlgorithmInfo* algorithm : matrix.algorithms) {
+                for (int threads : matrix.threads) {
+                    if (!algorithm->parallel && threads != 1) {
+                        continue;
+                    }
+                    Cell cell = algorithm == &alphaBeta ? sequential
+                                                        : runCell(engine, topology, position, *algorithm, depth, threads, matrix);
+                    compareToSequential(cell, sequential);
+                    std::cout << "  " << std::left << std::setw(18) << algorithm->key << " depth " << depth
+                              << " threads " << std::setw(3) << threads << std::fixed << std::setprecision(6)
+                              << " median " << cell.median << "s min " << cell.min << "s stddev " << cell.stddev
+                              << "s nodes " << cell.nodes << " nps " << static_cast<uint64_t>(cell.nps)
+                              << " " << cell.bestMove << " " << cell.score << "\n";
+                    const StockDory::SearchStatTotals &stats = cell.stats;
+                    std::cout << "    evals " << stats[StockDory::StatLeafEvals] << " cutoffs "
+                              << stats[StockDory::StatBetaCutoffs] << " (first move " << std::setprecision(1)
+                              << stats.FirstMoveCutoffRate() * 100 << "%) hash " << stats[StockDory::StatHashHits]
+                              << "/" << stats[StockDory::StatHashProbes] << " splits " << stats[StockDory::StatSplits]
+                              << " aborts " << stats[StockDory::StatAborts] << " critical "
+                              << stats[StockDory::StatCriticalSections] << "\n";
+                    if (StockDory::PerfCounters::Active()) {
+                        printPerf(cell);
+                    }
+                    cells.push_back(cell);
+                }
+            }
+            printOverheads(cells, first, depth);
+        }
+    }
+
+    if (outputs.count("--csv")) {
+        std::ofstream csv(outputs["--csv"]);
+        writeCsv(csv, cells);
+    }
+    if (outputs.count("--json")) {
+        std::ofstream json(outputs["--json"]);
+        writeJson(json, cells);
+    }
+    return 0;
+}
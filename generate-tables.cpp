@@ -0,0 +1,65 @@
+// generate-tables.cpp
+// Build-time generator for the slider tables. It is compiled without STOCKDORY_GENERATED_TABLES, so the tables are
+// filled at startup as usual, and writes them out as constant definitions:
+//   <output directory>/GeneratedSliding.h  defines StockDory::AttackTable::Sliding
+//   <output directory>/GeneratedBetween.h  defines StockDory::UtilityTable::Between
+// Programs built with STOCKDORY_GENERATED_TABLES and that directory on their include path then get both tables as
+// read-only data instead of computing them. The generator has to be built with the same sliding backend
+// (STOCKDORY_PEXT or not) as the programs, the generated header checks the table size.
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <cstdint>
+#include "Backend/Move/AttackTable.h"
+#include "Backend/Move/UtilityTable.h"
+
+// Four entries per line, in the style of the hand written tables in AttackTable.h
+void writeEntries(std::ofstream &out, const BitBoard *entries, size_t count, const std::string &indent) {
+    for (size_t i = 0; i < count; i++) {
+        if (i % 4 == 0) {
+            out << indent;
+        }
+        out << "0x" << std::hex << std::uppercase << std::setw(16) << std::setfill('0') << entries[i] << std::dec;
+        if (i + 1 != count) {
+            out << ",";
+        }
+        out << (i % 4 == 3 || i + 1 == count ? "\n" : " ");
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc != 2) {
+        std::cerr << "Usage: " << argv[0] << " <output directory>\n";
+        return 1;
+    }
+    std::string directory = argv[1];
+
+    std::ofstream sliding(directory + "/GeneratedSliding.h");
+    if (!sliding) {
+        std::cerr << "Cannot write " << directory << "/GeneratedSliding.h\n";
+        return 1;
+    }
+    sliding << "// Generated by generate-tables, do not edit.\n";
+    sliding << "static_assert(StockDory::AttackTable::SlidingSize == " << StockDory::AttackTable::SlidingSize
+            << ", \"GeneratedSliding.h was generated for another sliding attack backend\");\n\n";
+    sliding << "constexpr std::array<BitBoard, StockDory::AttackTable::SlidingSize> StockDory::AttackTable::Sliding {\n";
+    writeEntries(sliding, StockDory::AttackTable::Sliding.data(), StockDory::AttackTable::Sliding.size(), "    ");
+    sliding << "};\n";
+
+    std::ofstream between(directory + "/GeneratedBetween.h");
+    if (!between) {
+        std::cerr << "Cannot write " << directory << "/GeneratedBetween.h\n";
+        return 1;
+    }
+    between << "// Generated by generate-tables, do not edit.\n";
+    between << "constexpr std::array<std::array<BitBoard, 64>, 64> StockDory::UtilityTable::Between {{\n";
+    for (uint8_t from = 0; from < 64; from++) {
+        between << "    {\n";
+        writeEntries(between, StockDory::UtilityTable::Between[from].data(), 64, "        ");
+        between << (from == 63 ? "    }\n" : "    },\n");
+    }
+    between << "}};\n";
+
+    return 0;
+}
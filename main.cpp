@@ -9,7 +9,6 @@
 #include "Backend/Type/Color.h"
 #include "Engine.h"
 #include <omp.h>
-#include <fstream> // For file I/O
 #include <iomanip> // For formatting output
 #include <atomic>
 
@@ -38,8 +37,10 @@ void displayAlgorithmOptions() {
     std::cout << "5. Naive Parallel Alpha Beta with PV\n";
     std::cout << "6. Young Brothers Wait Concept (YBWC)\n";
     std::cout << "7. Principal Variation Search (PVS)\n";
-    std::cout << "8. testing function\n";
-    std::cout << "Enter your choice (1 to 8): ";
+    std::cout << "9. ABDADA\n";
+    std::cout << "10. Dynamic Tree Splitting (DTS)\n";
+    std::cout << "11. Task-based YBWC\n";
+    std::cout << "Enter your choice (1 to 11): ";
 }
 
 int main(int argc, char* argv[]) {
@@ -74,10 +75,10 @@ int main(int argc, char* argv[]) {
             continue;
         }
 
-        if (algorithmChoice == 1 || algorithmChoice == 2 || algorithmChoice == 3 || algorithmChoice == 4 || algorithmChoice == 5 || algorithmChoice == 6 || algorithmChoice == 7 || algorithmChoice == 8) {
+        if (algorithmChoice == 1 || algorithmChoice == 2 || algorithmChoice == 3 || algorithmChoice == 4 || algorithmChoice == 5 || algorithmChoice == 6 || algorithmChoice == 7|| algorithmChoice == 9 || algorithmChoice == 10 || algorithmChoice == 11) {
             break; // Valid choice
         } else {
-            std::cerr << "Invalid choice: " << algorithmChoice << ". Please enter 1 to 8.\n";
+            std::cerr << "Invalid choice: " << algorithmChoice << ". Please enter 1 to 11.\n";
         }
     }
 
@@ -105,8 +106,14 @@ int main(int argc, char* argv[]) {
         case 7:
             algorithmName = "Principal Variation Search (PVS)";
             break;
-        case 8:
-            algorithmName = "Testing Function";
+        case 9:
+            algorithmName = "ABDADA";
+            break;
+        case 10:
+            algorithmName = "Dynamic Tree Splitting (DTS)";
+            break;
+        case 11:
+            algorithmName = "Task-based YBWC";
             break;
         default:
             // This case should never occur due to the earlier validation
@@ -120,20 +127,18 @@ int main(int argc, char* argv[]) {
     std::string FEN = "";
     StockDory::Board chessBoard;
     int nThreads = 1;
-    if (algorithmChoice != 8) {
-        std::cin.clear();
-        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-        std::cout << "Input FEN (input 0 no FEN): ";
-        std::getline(std::cin, FEN);
-        if (FEN.compare("0") == 0) {
-            chessBoard = StockDory::Board();
-        }
-        else {
-            chessBoard = StockDory::Board(FEN);
-        }
-        std::cout << "Input number of threads (only applies to parallel algorithms, we tested betweeen 1-64): ";
-        std::cin >> nThreads;
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    std::cout << "Input FEN (input 0 no FEN): ";
+    std::getline(std::cin, FEN);
+    if (FEN.compare("0") == 0) {
+        chessBoard = StockDory::Board();
     }
+    else {
+        chessBoard = StockDory::Board(FEN);
+    }
+    std::cout << "Input number of threads (only applies to parallel algorithms, we tested betweeen 1-64): ";
+    std::cin >> nThreads;
 
     Engine engine;
 
@@ -578,1648 +583,197 @@ int main(int argc, char* argv[]) {
             }
         }
     }
-    else if (algorithmChoice == 8) {
-        // Disable or enable the below line based on whether you wanted nested parallelism or not.
-        // omp_set_nested(1);
-        const char* mateIn3FENs[] = {
-            "7k/8/3NK3/5BN1/8/8/8/8 w - - 0 1",
-            "k7/3K4/3N4/2N5/8/3B4/8/8 w - - 0 1",
-            "8/8/2K5/7r/6r1/8/6k1/8 b - - 0 1",
-            "8/K7/7r/8/2k5/5bb1/8/8 b - - 0 1",
-            "8/K7/P6r/8/2k5/5bb1/8/8 b - - 0 1",
-            "8/8/8/8/k7/4Q3/3K4/8 w - - 0 1",
-            "8/8/k7/2K5/8/2Q5/b1R5/n7 w - - 0 1",
-            "8/8/k1K1b3/2n5/8/8/8/2R5 w - - 0 1",
-            "8/7P/k1K1b3/2n5/8/8/8/2R5 w - - 0 1",
-            "7k/7n/8/8/8/7B/7R/6RK w - - 0 1"
-        };
-        std::ofstream resultFile("results-m3.txt");
-        if (!resultFile.is_open()) {
-            std::cerr << "Error: Unable to open results.txt for writing\n";
-            return 0;
-        }
-        std::cout << "Testing mate in 3 FENs\n";
-        for (const char* fen : mateIn3FENs) {
-            StockDory::Board chessBoard(fen);
-            resultFile << "Current Fen: " << fen << "\n";
-            std::cout << "Current Fen: " << fen << "\n" << std::endl;
-            for (int depth = 5; depth < 7; depth++) {
-                std::cout << "Testing depth: " << depth << "\n";
-                if (chessBoard.ColorToMove() == White) {
-                    int result = engine.minimaxMoveCounter<White>(
-                        chessBoard,
-                        depth
-                    );
-                    printf("Total number of moves in minimax: %d\n", result);
-                    resultFile << "Minimax moves: " << result << "\n";
-                }
-                if (chessBoard.ColorToMove() == White) {
-                    int count = 0;
-                    std::pair<std::array<Move, maxDepth>, int> result = engine.alphaBetaNegaMoveCounter<White, maxDepth>(
-                        chessBoard,
-                        -50000,
-                        50000,
-                        depth,
-                        count
-                    );
-                    printf("Total number of moves in alphaBeta: %d\n", count);
-                    resultFile << "AlphaBeta moves: " << count << "\n";
-                }
-                if (chessBoard.ColorToMove() == Black) {
-                    int result = engine.minimaxMoveCounter<Black>(
-                        chessBoard,
-                        depth
-                    );
-                    printf("Total number of moves in minimax: %d\n", result);
-                    resultFile << "Minimax moves: " << result << "\n";
-                }
-                if (chessBoard.ColorToMove() == Black) {
-                    int count = 0;
-                    std::pair<std::array<Move, maxDepth>, int> result = engine.alphaBetaNegaMoveCounter<Black, maxDepth>(
-                        chessBoard,
-                        -50000,
-                        50000,
-                        depth,
-                        count
-                    );
-                    printf("Total number of moves in alphaBeta: %d\n", count);
-                    resultFile << "AlphaBeta moves: " << count << "\n";
-                }
-                std::cout << "Algorithm: Sequential Minimax\n" << std::endl;
-                double totalTime = 0;
-                for (int i = 0; i < 20; i++) {
-                    if (chessBoard.ColorToMove() == White) {
-                         tstart = omp_get_wtime();
-                         std::pair<std::array<Move, maxDepth>, int> result = engine.minimax<White, maxDepth>(
-                             chessBoard,
-                             depth
-                         );
-                         tend = omp_get_wtime();
-                         ttaken = tend - tstart;
-                         totalTime += ttaken;
-
-                         printf("Time taken for main part minimax: %f\n", ttaken);
-
-                         if (!result.first.empty()) {
-                             Move bestMove = result.first.front();
-                             std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-                                       << " with score " << result.second << "\n";
-
-                             std::cout << "Best line: ";
-                             for (int i = 0; i < depth; i++) {
-                                 Move move = result.first[i];
-                                 std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-                             }
-                             std::cout << "\n";
-                         } else {
-                             std::cout << "No moves available for White.\n";
-                         }
-                     }
-                    else if (chessBoard.ColorToMove() == Black) {
-                        tstart = omp_get_wtime();
-                        std::pair<std::array<Move, maxDepth>, int> result = engine.minimax<Black, maxDepth>(
-                            chessBoard,
-                            depth
-                        );
-                        tend = omp_get_wtime();
-                        ttaken = tend - tstart;
-                        totalTime += ttaken;
-
-                        printf("Time taken for main part minimax: %f\n", ttaken);
-
-                        if (!result.first.empty()) {
-                            Move bestMove = result.first.front();
-                            std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-                                      << " with score " << result.second << "\n";
-
-                            std::cout << "Best line: ";
-                            for (int i = 0; i < depth; i++) {
-                                Move move = result.first[i];
-                                std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-                            }
-                            std::cout << "\n";
-                        } else {
-                            std::cout << "No moves available for White.\n";
-                        }
-                    }
-                }
-                double averageTime = totalTime/20;
-                std::cout << "Average time for minimax in 20 iterations is: " << averageTime << "\n";
-                resultFile << "Sequential Minimax,1," << averageTime << "\n";
-
-                int numThreads[] = {1, 2, 4, 8, 16, 32, 64};
-
-                for (int threads : numThreads) {
-                    omp_set_num_threads(threads);
-                    std::cout << "Algorithm: Parallel Minimax\n" << std::endl;
-                    std::cout << "Total number of threads: " << threads << "\n" << std::endl;
-                    totalTime = 0;
-                    for (int i = 0; i < 20; i++) {
-                        if (chessBoard.ColorToMove() == White) {
-                            tstart = omp_get_wtime();
-                            std::pair<std::array<Move, maxDepth>, int> result = engine.parallelMinimax<White, maxDepth>(
-                                chessBoard,
-                                depth
-                            );
-                            tend = omp_get_wtime();
-                            ttaken = tend - tstart;
-                            totalTime += ttaken;
-
-                            printf("Time taken for main part parallel minimax: %f\n", ttaken);
-
-                            if (!result.first.empty()) {
-                                Move bestMove = result.first.front();
-                                std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-                                          << " with score " << result.second << "\n";
-
-                                std::cout << "Best line: ";
-                                for (int i = 0; i < depth; i++) {
-                                    Move move = result.first[i];
-                                    std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-                                }
-                                std::cout << "\n";
-                            } else {
-                                std::cout << "No moves available for White.\n";
-                            }
-                        }
-                        else if (chessBoard.ColorToMove() == Black) {
-                            tstart = omp_get_wtime();
-                            std::pair<std::array<Move, maxDepth>, int> result = engine.parallelMinimax<Black, maxDepth>(
-                                chessBoard,
-                                depth
-                            );
-                            tend = omp_get_wtime();
-                            ttaken = tend - tstart;
-                            totalTime += ttaken;
-
-                            printf("Time taken for main part parallel minimax: %f\n", ttaken);
-
-                            if (!result.first.empty()) {
-                                Move bestMove = result.first.front();
-                                std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-                                          << " with score " << result.second << "\n";
+    else if (algorithmChoice == 9) { // ABDADA
+        if (currentPlayer == White) {
+            // Perform ABDADA for White
+            tstart = omp_get_wtime();
+            result = engine.ABDADA<White, maxDepth>(
+                chessBoard,
+                -50000,
+                50000,
+                depth
+            );
+            tend = omp_get_wtime();
+            ttaken = tend-tstart;
+            printf("Time taken for main part: %f\n", ttaken);
+            // Check if there is at least one move in the sequence
+            if (!result.first.empty()) {
+                Move bestMove = result.first.front();
+                std::cout << "White's Best Move (ABDADA): "
+                          << squareToString(bestMove.From()) << " to "
+                          << squareToString(bestMove.To())
+                          << " with score " << result.second << "\n";
 
-                                std::cout << "Best line: ";
-                                for (int i = 0; i < depth; i++) {
-                                    Move move = result.first[i];
-                                    std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-                                }
-                                std::cout << "\n";
-                            } else {
-                                std::cout << "No moves available for White.\n";
-                            }
-                        }
-                    }
-                    averageTime = totalTime/20;
-                    std::cout << "Average time for parallel minimax in 20 iterations is: " << averageTime << " with " << threads << " threads" << "\n";
-                    resultFile << "Parallel Minimax," << threads << "," << averageTime << "\n";
+                // Print the entire sequence of moves (best line)
+                std::cout << "Best Line: ";
+                for (const Move &move : result.first) {
+                    std::cout << squareToString(move.From()) << " to "
+                              << squareToString(move.To()) << ", ";
                 }
+                std::cout << "\n";
+            } else {
+                std::cout << "No moves available for White.\n";
+            }
+        }
+        else if (currentPlayer == Black) {
+            // Perform ABDADA for Black
+            tstart = omp_get_wtime();
+            result = engine.ABDADA<Black, maxDepth>(
+                chessBoard,
+                -50000,
+                50000,
+                depth
+            );
+            tend = omp_get_wtime();
+            ttaken = tend-tstart;
+            printf("Time taken for main part: %f\n", ttaken);
+            // Check if there is at least one move in the sequence
+            if (!result.first.empty()) {
+                Move bestMove = result.first.front();
+                std::cout << "Black's Best Move (ABDADA): "
+                          << squareToString(bestMove.From()) << " to "
+                          << squareToString(bestMove.To())
+                          << " with score " << result.second << "\n";
 
-                std::cout << "Algorithm: Sequential AlphaBeta\n" << std::endl;
-                totalTime = 0;
-                for (int i = 0; i < 20; i++) {
-                    if (chessBoard.ColorToMove() == White) {
-                        tstart = omp_get_wtime();
-                        std::pair<std::array<Move, maxDepth>, int> result = engine.alphaBetaNega<White, maxDepth>(
-                        chessBoard,
-                        -50000,
-                        50000,
-                            depth
-                        );
-                        tend = omp_get_wtime();
-                        ttaken = tend - tstart;
-                        totalTime += ttaken;
-
-                        printf("Time taken for main part sequential alpha beta: %f\n", ttaken);
-
-                        if (!result.first.empty()) {
-                            Move bestMove = result.first.front();
-                            std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-                                      << " with score " << result.second << "\n";
-
-                            std::cout << "Best line: ";
-                            for (int i = 0; i < depth; i++) {
-                                Move move = result.first[i];
-                                std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-                            }
-                            std::cout << "\n";
-                        } else {
-                            std::cout << "No moves available for White.\n";
-                        }
-                    }
-                    else if (chessBoard.ColorToMove() == Black) {
-                        tstart = omp_get_wtime();
-                        std::pair<std::array<Move, maxDepth>, int> result = engine.alphaBetaNega<Black, maxDepth>(
-                        chessBoard,
-                        -50000,
-                        50000,
-                            depth
-                        );
-                        tend = omp_get_wtime();
-                        ttaken = tend - tstart;
-                        totalTime += ttaken;
-
-                        printf("Time taken for main part sequential alpha beta: %f\n", ttaken);
-
-                        if (!result.first.empty()) {
-                            Move bestMove = result.first.front();
-                            std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-                                      << " with score " << result.second << "\n";
-
-                            std::cout << "Best line: ";
-                            for (int i = 0; i < depth; i++) {
-                                Move move = result.first[i];
-                                std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-                            }
-                            std::cout << "\n";
-                        } else {
-                            std::cout << "No moves available for White.\n";
-                        }
-                    }
+                // Print the entire sequence of moves (best line)
+                std::cout << "Best Line: ";
+                for (const Move &move : result.first) {
+                    std::cout << squareToString(move.From()) << " to "
+                              << squareToString(move.To()) << ", ";
                 }
-                averageTime = totalTime/20;
-                std::cout << "Average time for sequential AlphaBeta in 20 iterations is: " << averageTime << "\n";
-                resultFile << "Sequential AlphaBeta,1," << averageTime << "\n";
-
-                for (int threads : numThreads) {
-                    omp_set_num_threads(threads);
-                    std::cout << "Algorithm: Naive Alpha Beta Parallel\n" << std::endl;
-
-                    std::cout << "Total number of threads: " << threads << "\n" << std::endl;
-                    totalTime = 0;
-                    for (int i = 0; i < 20; i++) {
-                        if (chessBoard.ColorToMove() == White) {
-                            tstart = omp_get_wtime();
-                            std::pair<std::array<Move, maxDepth>, int> result = engine.naiveParallelAlphaBeta<White, maxDepth>(
-                                chessBoard,
-                                -50000,
-                                50000,
-                                depth
-                            );
-                            tend = omp_get_wtime();
-                            ttaken = tend - tstart;
-                            totalTime += ttaken;
-
-                            printf("Time taken for main part naive alpha beta parallel: %f\n", ttaken);
-
-                            if (!result.first.empty()) {
-                                Move bestMove = result.first.front();
-                                std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-                                          << " with score " << result.second << "\n";
-
-                                std::cout << "Best line: ";
-                                for (int i = 0; i < depth; i++) {
-                                    Move move = result.first[i];
-                                    std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-                                }
-                                std::cout << "\n";
-                            } else {
-                                std::cout << "No moves available for White.\n";
-                            }
-                        }
-                        else if (chessBoard.ColorToMove() == Black) {
-                            tstart = omp_get_wtime();
-                            std::pair<std::array<Move, maxDepth>, int> result = engine.naiveParallelAlphaBeta<Black, maxDepth>(
-                                chessBoard,
-                                -50000,
-                                50000,
-                                depth
-                            );
-                            tend = omp_get_wtime();
-                            ttaken = tend - tstart;
-                            totalTime += ttaken;
-
-                            printf("Time taken for main part naive alpha beta parallel: %f\n", ttaken);
-
-                            if (!result.first.empty()) {
-                                Move bestMove = result.first.front();
-                                std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-                                          << " with score " << result.second << "\n";
+                std::cout << "\n";
+            } else {
+                std::cout << "No moves available for Black.\n";
+            }
+        }
+    }
+    else if (algorithmChoice == 10) { // DTS
+        if (currentPlayer == White) {
+            // Perform DTS for White
+            tstart = omp_get_wtime();
+            result = engine.DTS<White, maxDepth>(
+                chessBoard,
+                -50000,
+                50000,
+                depth
+            );
+            tend = omp_get_wtime();
+            ttaken = tend-tstart;
+            printf("Time taken for main part: %f\n", ttaken);
+            // Check if there is at least one move in the sequence
+            if (!result.first.empty()) {
+                Move bestMove = result.first.front();
+                std::cout << "White's Best Move (DTS): "
+                          << squareToString(bestMove.From()) << " to "
+                          << squareToString(bestMove.To())
+                          << " with score " << result.second << "\n";
 
-                                std::cout << "Best line: ";
-                                for (int i = 0; i < depth; i++) {
-                                    Move move = result.first[i];
-                                    std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-                                }
-                                std::cout << "\n";
-                            } else {
-                                std::cout << "No moves available for White.\n";
-                            }
-                        }
-                    }
-                    averageTime = totalTime/20;
-                    std::cout << "Average time for naive alpha beta parallel in 20 iterations is: " << averageTime << " with " << threads << " threads" << "\n";
-                    resultFile << "Naive Parallel Alpha Beta," << threads << "," << averageTime << "\n";
+                // Print the entire sequence of moves (best line)
+                std::cout << "Best Line: ";
+                for (const Move &move : result.first) {
+                    std::cout << squareToString(move.From()) << " to "
+                              << squareToString(move.To()) << ", ";
                 }
+                std::cout << "\n";
+            } else {
+                std::cout << "No moves available for White.\n";
+            }
+        }
+        else if (currentPlayer == Black) {
+            // Perform DTS for Black
+            tstart = omp_get_wtime();
+            result = engine.DTS<Black, maxDepth>(
+                chessBoard,
+                -50000,
+                50000,
+                depth
+            );
+            tend = omp_get_wtime();
+            ttaken = tend-tstart;
+            printf("Time taken for main part: %f\n", ttaken);
+            // Check if there is at least one move in the sequence
+            if (!result.first.empty()) {
+                Move bestMove = result.first.front();
+                std::cout << "Black's Best Move (DTS): "
+                          << squareToString(bestMove.From()) << " to "
+                          << squareToString(bestMove.To())
+                          << " with score " << result.second << "\n";
 
-                for (int threads : numThreads) {
-                    omp_set_num_threads(threads);
-                    std::cout << "Algorithm: Naive Alpha Beta Parallel\n" << std::endl;
-
-                    std::cout << "Total number of threads: " << threads << "\n" << std::endl;
-                    totalTime = 0;
-                    for (int i = 0; i < 20; i++) {
-                        if (chessBoard.ColorToMove() == White) {
-                            tstart = omp_get_wtime();
-                            std::pair<std::array<Move, maxDepth>, int> result = engine.naiveParallelPVAlphaBeta<White, maxDepth>(
-                                chessBoard,
-                                -50000,
-                                50000,
-                                depth
-                            );
-                            tend = omp_get_wtime();
-                            ttaken = tend - tstart;
-                            totalTime += ttaken;
-
-                            printf("Time taken for main part naive alpha beta parallel with PV combo: %f\n", ttaken);
-
-                            if (!result.first.empty()) {
-                                Move bestMove = result.first.front();
-                                std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-                                          << " with score " << result.second << "\n";
-
-                                std::cout << "Best line: ";
-                                for (int i = 0; i < depth; i++) {
-                                    Move move = result.first[i];
-                                    std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-                                }
-                                std::cout << "\n";
-                            } else {
-                                std::cout << "No moves available for White.\n";
-                            }
-                        }
-                        else if (chessBoard.ColorToMove() == Black) {
-                            tstart = omp_get_wtime();
-                            std::pair<std::array<Move, maxDepth>, int> result = engine.naiveParallelPVAlphaBeta<Black, maxDepth>(
-                                chessBoard,
-                                -50000,
-                                50000,
-                                depth
-                            );
-                            tend = omp_get_wtime();
-                            ttaken = tend - tstart;
-                            totalTime += ttaken;
-
-                            printf("Time taken for main part naive alpha beta parallel with PV combo: %f\n", ttaken);
-
-                            if (!result.first.empty()) {
-                                Move bestMove = result.first.front();
-                                std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-                                          << " with score " << result.second << "\n";
-
-                                std::cout << "Best line: ";
-                                for (int i = 0; i < depth; i++) {
-                                    Move move = result.first[i];
-                                    std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-                                }
-                                std::cout << "\n";
-                            } else {
-                                std::cout << "No moves available for White.\n";
-                            }
-                        }
-                    }
-                    averageTime = totalTime/20;
-                    std::cout << "Average time for naive alpha beta parallel with YBWC combo in 20 iterations is: " << averageTime << " with " << threads << " threads" << "\n";
-                    resultFile << "Naive Parallel Alpha Beta with PV," << threads << "," << averageTime << "\n";
+                // Print the entire sequence of moves (best line)
+                std::cout << "Best Line: ";
+                for (const Move &move : result.first) {
+                    std::cout << squareToString(move.From()) << " to "
+                              << squareToString(move.To()) << ", ";
                 }
+                std::cout << "\n";
+            } else {
+                std::cout << "No moves available for Black.\n";
+            }
+        }
+    }
+    else if (algorithmChoice == 11) { // Task-based YBWC
+        if (currentPlayer == White) {
+            // Perform task-based YBWC for White
+            tstart = omp_get_wtime();
+            result = engine.YBWCTask<White, maxDepth>(
+                chessBoard,
+                -50000,
+                50000,
+                depth
+            );
+            tend = omp_get_wtime();
+            ttaken = tend-tstart;
+            printf("Time taken for main part: %f\n", ttaken);
+            // Check if there is at least one move in the sequence
+            if (!result.first.empty()) {
+                Move bestMove = result.first.front();
+                std::cout << "White's Best Move (Task-based YBWC): "
+                          << squareToString(bestMove.From()) << " to "
+                          << squareToString(bestMove.To())
+                          << " with score " << result.second << "\n";
 
-                for (int threads : numThreads) {
-                    omp_set_num_threads(threads);
-                    std::cout << "Algorithm: YBWC\n" << std::endl;
-
-                    std::cout << "Total number of threads: " << threads << "\n" << std::endl;
-                    totalTime = 0;
-                    for (int i = 0; i < 20; i++) {
-                        if (chessBoard.ColorToMove() == White) {
-                            tstart = omp_get_wtime();
-                            std::pair<std::array<Move, maxDepth>, int> result = engine.YBWC<White, maxDepth>(
-                                chessBoard,
-                                -50000,
-                                50000,
-                                depth
-                            );
-                            tend = omp_get_wtime();
-                            ttaken = tend - tstart;
-                            totalTime += ttaken;
-
-                            printf("Time taken for main part YBWC: %f\n", ttaken);
-
-                            if (!result.first.empty()) {
-                                Move bestMove = result.first.front();
-                                std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-                                          << " with score " << result.second << "\n";
-
-                                std::cout << "Best line: ";
-                                for (int i = 0; i < depth; i++) {
-                                    Move move = result.first[i];
-                                    std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-                                }
-                                std::cout << "\n";
-                            } else {
-                                std::cout << "No moves available for White.\n";
-                            }
-                        }
-                        else if (chessBoard.ColorToMove() == Black) {
-                            tstart = omp_get_wtime();
-                            std::pair<std::array<Move, maxDepth>, int> result = engine.YBWC<Black, maxDepth>(
-                                chessBoard,
-                                -50000,
-                                50000,
-                                depth
-                            );
-                            tend = omp_get_wtime();
-                            ttaken = tend - tstart;
-                            totalTime += ttaken;
-
-                            printf("Time taken for main part YBWC: %f\n", ttaken);
-
-                            if (!result.first.empty()) {
-                                Move bestMove = result.first.front();
-                                std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-                                          << " with score " << result.second << "\n";
-
-                                std::cout << "Best line: ";
-                                for (int i = 0; i < depth; i++) {
-                                    Move move = result.first[i];
-                                    std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-                                }
-                                std::cout << "\n";
-                            } else {
-                                std::cout << "No moves available for White.\n";
-                            }
-                        }
-                    }
-                    averageTime = totalTime/20;
-                    std::cout << "Average time for YBWC in 20 iterations is: " << averageTime << " with " << threads << " threads" << "\n";
-                    resultFile << "YBWC," << threads << "," << averageTime << "\n";
+                // Print the entire sequence of moves (best line)
+                std::cout << "Best Line: ";
+                for (const Move &move : result.first) {
+                    std::cout << squareToString(move.From()) << " to "
+                              << squareToString(move.To()) << ", ";
                 }
+                std::cout << "\n";
+            } else {
+                std::cout << "No moves available for White.\n";
+            }
+        }
+        else if (currentPlayer == Black) {
+            // Perform task-based YBWC for Black
+            tstart = omp_get_wtime();
+            result = engine.YBWCTask<Black, maxDepth>(
+                chessBoard,
+                -50000,
+                50000,
+                depth
+            );
+            tend = omp_get_wtime();
+            ttaken = tend-tstart;
+            printf("Time taken for main part: %f\n", ttaken);
+            // Check if there is at least one move in the sequence
+            if (!result.first.empty()) {
+                Move bestMove = result.first.front();
+                std::cout << "Black's Best Move (Task-based YBWC): "
+                          << squareToString(bestMove.From()) << " to "
+                          << squareToString(bestMove.To())
+                          << " with score " << result.second << "\n";
 
-                for (int threads : numThreads) {
-                    omp_set_num_threads(threads);
-                    std::cout << "Algorithm: PVS\n" << std::endl;
-
-                    std::cout << "Total number of threads: " << threads << "\n" << std::endl;
-                    totalTime = 0;
-                    for (int i = 0; i < 20; i++) {
-                        if (chessBoard.ColorToMove() == White) {
-                            tstart = omp_get_wtime();
-                            std::pair<std::array<Move, maxDepth>, int> result = engine.PVS<White, maxDepth>(
-                                chessBoard,
-                                -50000,
-                                50000,
-                                depth
-                            );
-                            tend = omp_get_wtime();
-                            ttaken = tend - tstart;
-                            totalTime += ttaken;
-
-                            printf("Time taken for main part PVS: %f\n", ttaken);
-
-                            if (!result.first.empty()) {
-                                Move bestMove = result.first.front();
-                                std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-                                          << " with score " << result.second << "\n";
-
-                                std::cout << "Best line: ";
-                                for (int i = 0; i < depth; i++) {
-                                    Move move = result.first[i];
-                                    std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-                                }
-                                std::cout << "\n";
-                            } else {
-                                std::cout << "No moves available for White.\n";
-                            }
-                        }
-                        else if (chessBoard.ColorToMove() == Black) {
-                            tstart = omp_get_wtime();
-                            std::pair<std::array<Move, maxDepth>, int> result = engine.PVS<Black, maxDepth>(
-                                chessBoard,
-                                -50000,
-                                50000,
-                                depth
-                            );
-                            tend = omp_get_wtime();
-                            ttaken = tend - tstart;
-                            totalTime += ttaken;
-
-                            printf("Time taken for main part PVS: %f\n", ttaken);
-
-                            if (!result.first.empty()) {
-                                Move bestMove = result.first.front();
-                                std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-                                          << " with score " << result.second << "\n";
-
-                                std::cout << "Best line: ";
-                                for (int i = 0; i < depth; i++) {
-                                    Move move = result.first[i];
-                                    std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-                                }
-                                std::cout << "\n";
-                            } else {
-                                std::cout << "No moves available for White.\n";
-                            }
-                        }
-                    }
-                    averageTime = totalTime/20;
-                    std::cout << "Average time for PVS in 20 iterations is: " << averageTime << " with " << threads << " threads" << "\n";
-                    resultFile << "PVS," << threads << "," << averageTime << "\n";
+                // Print the entire sequence of moves (best line)
+                std::cout << "Best Line: ";
+                for (const Move &move : result.first) {
+                    std::cout << squareToString(move.From()) << " to "
+                              << squareToString(move.To()) << ", ";
                 }
+                std::cout << "\n";
+            } else {
+                std::cout << "No moves available for Black.\n";
             }
-
         }
-
-        // const char* mateIn2FENs[] = {
-        //     "8/8/8/8/8/1k6/2nb4/1K6 b - - 0 1",
-        //     "1r6/8/8/8/8/1k6/8/K7 b - - 0 1",
-        //     "1q6/8/8/8/8/1k6/8/K7 b - - 0 1",
-        //     "1q6/8/8/8/8/1k6/PPP5/K7 b - - 0 1",
-        //     "8/8/8/8/1k6/n2q4/PP6/K6R b - - 0 1",
-        //     "5k2/4p2Q/8/5P2/b5R1/8/3P4/3KR3 w - - 0 1",
-        //     "5k2/3p4/5K1P/8/8/8/8/8 w - - 0 1"
-        // };
-        //
-        // std::ofstream resultFile2("results-m2.txt");
-        // if (!resultFile2.is_open()) {
-        //     std::cerr << "Error: Unable to open results.txt for writing\n";
-        //     return 0;
-        // }
-        // std::cout << "Testing mate in 2 FENs\n";
-        // for (const char* fen : mateIn2FENs) {
-        //     StockDory::Board chessBoard(fen);
-        //     resultFile2 << "Current Fen: " << fen << "\n";
-        //     std::cout << "Current Fen: " << fen << "\n" << std::endl;
-        //     for (int depth = 3; depth < 5; depth++) {
-        //         std::cout << "Testing depth: " << depth << "\n";
-        //         if (chessBoard.ColorToMove() == White) {
-        //             int result = engine.minimaxMoveCounter<White>(
-        //                 chessBoard,
-        //                 depth
-        //             );
-        //             printf("Total number of moves in minimax: %d\n", result);
-        //             resultFile2 << "Minimax moves: " << result << "\n";
-        //         }
-        //         if (chessBoard.ColorToMove() == White) {
-        //             int count = 0;
-        //             std::pair<std::array<Move, maxDepth>, int> result = engine.alphaBetaNegaMoveCounter<White, maxDepth>(
-        //                 chessBoard,
-        //                 -50000,
-        //                 50000,
-        //                 depth,
-        //                 count
-        //             );
-        //             printf("Total number of moves in alphaBeta: %d\n", count);
-        //             resultFile2 << "AlphaBeta moves: " << count << "\n";
-        //         }
-        //         if (chessBoard.ColorToMove() == Black) {
-        //             int result = engine.minimaxMoveCounter<Black>(
-        //                 chessBoard,
-        //                 depth
-        //             );
-        //             printf("Total number of moves in minimax: %d\n", result);
-        //             resultFile2 << "Minimax moves: " << result << "\n";
-        //         }
-        //         if (chessBoard.ColorToMove() == Black) {
-        //             int count = 0;
-        //             std::pair<std::array<Move, maxDepth>, int> result = engine.alphaBetaNegaMoveCounter<Black, maxDepth>(
-        //                 chessBoard,
-        //                 -50000,
-        //                 50000,
-        //                 depth,
-        //                 count
-        //             );
-        //             printf("Total number of moves in alphaBeta: %d\n", count);
-        //             resultFile2 << "AlphaBeta moves: " << count << "\n";
-        //         }
-        //         std::cout << "Algorithm: Sequential Minimax\n" << std::endl;
-        //         double totalTime = 0;
-        //         for (int i = 0; i < 20; i++) {
-        //             if (chessBoard.ColorToMove() == White) {
-        //                  tstart = omp_get_wtime();
-        //                  std::pair<std::array<Move, maxDepth>, int> result = engine.minimax<White, maxDepth>(
-        //                      chessBoard,
-        //                      depth
-        //                  );
-        //                  tend = omp_get_wtime();
-        //                  ttaken = tend - tstart;
-        //                  totalTime += ttaken;
-        //
-        //                  printf("Time taken for main part minimax: %f\n", ttaken);
-        //
-        //                  if (!result.first.empty()) {
-        //                      Move bestMove = result.first.front();
-        //                      std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-        //                                << " with score " << result.second << "\n";
-        //
-        //                      std::cout << "Best line: ";
-        //                      for (int i = 0; i < depth; i++) {
-        //                          Move move = result.first[i];
-        //                          std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-        //                      }
-        //                      std::cout << "\n";
-        //                  } else {
-        //                      std::cout << "No moves available for White.\n";
-        //                  }
-        //              }
-        //             else if (chessBoard.ColorToMove() == Black) {
-        //                 tstart = omp_get_wtime();
-        //                 std::pair<std::array<Move, maxDepth>, int> result = engine.minimax<Black, maxDepth>(
-        //                     chessBoard,
-        //                     depth
-        //                 );
-        //                 tend = omp_get_wtime();
-        //                 ttaken = tend - tstart;
-        //                 totalTime += ttaken;
-        //
-        //                 printf("Time taken for main part minimax: %f\n", ttaken);
-        //
-        //                 if (!result.first.empty()) {
-        //                     Move bestMove = result.first.front();
-        //                     std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-        //                               << " with score " << result.second << "\n";
-        //
-        //                     std::cout << "Best line: ";
-        //                     for (int i = 0; i < depth; i++) {
-        //                         Move move = result.first[i];
-        //                         std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-        //                     }
-        //                     std::cout << "\n";
-        //                 } else {
-        //                     std::cout << "No moves available for White.\n";
-        //                 }
-        //             }
-        //         }
-        //         double averageTime = totalTime/20;
-        //         std::cout << "Average time for minimax in 20 iterations is: " << averageTime << "\n";
-        //         resultFile2 << "Sequential Minimax,1," << averageTime << "\n";
-        //
-        //         int numThreads[] = {1, 2, 4, 8, 16, 32, 64};
-        //
-        //         for (int threads : numThreads) {
-        //             omp_set_num_threads(threads);
-        //             std::cout << "Algorithm: Parallel Minimax\n" << std::endl;
-        //             std::cout << "Total number of threads: " << threads << "\n" << std::endl;
-        //             totalTime = 0;
-        //             for (int i = 0; i < 20; i++) {
-        //                 if (chessBoard.ColorToMove() == White) {
-        //                     tstart = omp_get_wtime();
-        //                     std::pair<std::array<Move, maxDepth>, int> result = engine.parallelMinimax<White, maxDepth>(
-        //                         chessBoard,
-        //                         depth
-        //                     );
-        //                     tend = omp_get_wtime();
-        //                     ttaken = tend - tstart;
-        //                     totalTime += ttaken;
-        //
-        //                     printf("Time taken for main part parallel minimax: %f\n", ttaken);
-        //
-        //                     if (!result.first.empty()) {
-        //                         Move bestMove = result.first.front();
-        //                         std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-        //                                   << " with score " << result.second << "\n";
-        //
-        //                         std::cout << "Best line: ";
-        //                         for (int i = 0; i < depth; i++) {
-        //                             Move move = result.first[i];
-        //                             std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-        //                         }
-        //                         std::cout << "\n";
-        //                     } else {
-        //                         std::cout << "No moves available for White.\n";
-        //                     }
-        //                 }
-        //                 else if (chessBoard.ColorToMove() == Black) {
-        //                     tstart = omp_get_wtime();
-        //                     std::pair<std::array<Move, maxDepth>, int> result = engine.parallelMinimax<Black, maxDepth>(
-        //                         chessBoard,
-        //                         depth
-        //                     );
-        //                     tend = omp_get_wtime();
-        //                     ttaken = tend - tstart;
-        //                     totalTime += ttaken;
-        //
-        //                     printf("Time taken for main part parallel minimax: %f\n", ttaken);
-        //
-        //                     if (!result.first.empty()) {
-        //                         Move bestMove = result.first.front();
-        //                         std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-        //                                   << " with score " << result.second << "\n";
-        //
-        //                         std::cout << "Best line: ";
-        //                         for (int i = 0; i < depth; i++) {
-        //                             Move move = result.first[i];
-        //                             std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-        //                         }
-        //                         std::cout << "\n";
-        //                     } else {
-        //                         std::cout << "No moves available for White.\n";
-        //                     }
-        //                 }
-        //             }
-        //             averageTime = totalTime/20;
-        //             std::cout << "Average time for parallel minimax in 20 iterations is: " << averageTime << " with " << threads << " threads" << "\n";
-        //             resultFile2 << "Parallel Minimax," << threads << "," << averageTime << "\n";
-        //         }
-        //
-        //         std::cout << "Algorithm: Sequential AlphaBeta\n" << std::endl;
-        //         totalTime = 0;
-        //         for (int i = 0; i < 20; i++) {
-        //             if (chessBoard.ColorToMove() == White) {
-        //                 tstart = omp_get_wtime();
-        //                 std::pair<std::array<Move, maxDepth>, int> result = engine.alphaBetaNega<White, maxDepth>(
-        //                 chessBoard,
-        //                 -50000,
-        //                 50000,
-        //                     depth
-        //                 );
-        //                 tend = omp_get_wtime();
-        //                 ttaken = tend - tstart;
-        //                 totalTime += ttaken;
-        //
-        //                 printf("Time taken for main part sequential alpha beta: %f\n", ttaken);
-        //
-        //                 if (!result.first.empty()) {
-        //                     Move bestMove = result.first.front();
-        //                     std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-        //                               << " with score " << result.second << "\n";
-        //
-        //                     std::cout << "Best line: ";
-        //                     for (int i = 0; i < depth; i++) {
-        //                         Move move = result.first[i];
-        //                         std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-        //                     }
-        //                     std::cout << "\n";
-        //                 } else {
-        //                     std::cout << "No moves available for White.\n";
-        //                 }
-        //             }
-        //             else if (chessBoard.ColorToMove() == Black) {
-        //                 tstart = omp_get_wtime();
-        //                 std::pair<std::array<Move, maxDepth>, int> result = engine.alphaBetaNega<Black, maxDepth>(
-        //                 chessBoard,
-        //                 -50000,
-        //                 50000,
-        //                     depth
-        //                 );
-        //                 tend = omp_get_wtime();
-        //                 ttaken = tend - tstart;
-        //                 totalTime += ttaken;
-        //
-        //                 printf("Time taken for main part sequential alpha beta: %f\n", ttaken);
-        //
-        //                 if (!result.first.empty()) {
-        //                     Move bestMove = result.first.front();
-        //                     std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-        //                               << " with score " << result.second << "\n";
-        //
-        //                     std::cout << "Best line: ";
-        //                     for (int i = 0; i < depth; i++) {
-        //                         Move move = result.first[i];
-        //                         std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-        //                     }
-        //                     std::cout << "\n";
-        //                 } else {
-        //                     std::cout << "No moves available for White.\n";
-        //                 }
-        //             }
-        //         }
-        //         averageTime = totalTime/20;
-        //         std::cout << "Average time for sequential AlphaBeta in 20 iterations is: " << averageTime << "\n";
-        //         resultFile2 << "Sequential AlphaBeta,1," << averageTime << "\n";
-        //
-        //         for (int threads : numThreads) {
-        //             omp_set_num_threads(threads);
-        //             std::cout << "Algorithm: Naive Alpha Beta Parallel\n" << std::endl;
-        //
-        //             std::cout << "Total number of threads: " << threads << "\n" << std::endl;
-        //             totalTime = 0;
-        //             for (int i = 0; i < 20; i++) {
-        //                 if (chessBoard.ColorToMove() == White) {
-        //                     tstart = omp_get_wtime();
-        //                     std::pair<std::array<Move, maxDepth>, int> result = engine.naiveParallelAlphaBeta<White, maxDepth>(
-        //                         chessBoard,
-        //                         -50000,
-        //                         50000,
-        //                         depth
-        //                     );
-        //                     tend = omp_get_wtime();
-        //                     ttaken = tend - tstart;
-        //                     totalTime += ttaken;
-        //
-        //                     printf("Time taken for main part naive alpha beta parallel: %f\n", ttaken);
-        //
-        //                     if (!result.first.empty()) {
-        //                         Move bestMove = result.first.front();
-        //                         std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-        //                                   << " with score " << result.second << "\n";
-        //
-        //                         std::cout << "Best line: ";
-        //                         for (int i = 0; i < depth; i++) {
-        //                             Move move = result.first[i];
-        //                             std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-        //                         }
-        //                         std::cout << "\n";
-        //                     } else {
-        //                         std::cout << "No moves available for White.\n";
-        //                     }
-        //                 }
-        //                 else if (chessBoard.ColorToMove() == Black) {
-        //                     tstart = omp_get_wtime();
-        //                     std::pair<std::array<Move, maxDepth>, int> result = engine.naiveParallelAlphaBeta<Black, maxDepth>(
-        //                         chessBoard,
-        //                         -50000,
-        //                         50000,
-        //                         depth
-        //                     );
-        //                     tend = omp_get_wtime();
-        //                     ttaken = tend - tstart;
-        //                     totalTime += ttaken;
-        //
-        //                     printf("Time taken for main part naive alpha beta parallel: %f\n", ttaken);
-        //
-        //                     if (!result.first.empty()) {
-        //                         Move bestMove = result.first.front();
-        //                         std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-        //                                   << " with score " << result.second << "\n";
-        //
-        //                         std::cout << "Best line: ";
-        //                         for (int i = 0; i < depth; i++) {
-        //                             Move move = result.first[i];
-        //                             std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-        //                         }
-        //                         std::cout << "\n";
-        //                     } else {
-        //                         std::cout << "No moves available for White.\n";
-        //                     }
-        //                 }
-        //             }
-        //             averageTime = totalTime/20;
-        //             std::cout << "Average time for naive alpha beta parallel in 20 iterations is: " << averageTime << " with " << threads << " threads" << "\n";
-        //             resultFile2 << "Naive Parallel Alpha Beta," << threads << "," << averageTime << "\n";
-        //         }
-        //
-        //         for (int threads : numThreads) {
-        //             omp_set_num_threads(threads);
-        //             std::cout << "Algorithm: Naive Alpha Beta Parallel\n" << std::endl;
-        //
-        //             std::cout << "Total number of threads: " << threads << "\n" << std::endl;
-        //             totalTime = 0;
-        //             for (int i = 0; i < 20; i++) {
-        //                 if (chessBoard.ColorToMove() == White) {
-        //                     tstart = omp_get_wtime();
-        //                     std::pair<std::array<Move, maxDepth>, int> result = engine.naiveParallelPVAlphaBeta<White, maxDepth>(
-        //                         chessBoard,
-        //                         -50000,
-        //                         50000,
-        //                         depth
-        //                     );
-        //                     tend = omp_get_wtime();
-        //                     ttaken = tend - tstart;
-        //                     totalTime += ttaken;
-        //
-        //                     printf("Time taken for main part naive alpha beta parallel with PV combo: %f\n", ttaken);
-        //
-        //                     if (!result.first.empty()) {
-        //                         Move bestMove = result.first.front();
-        //                         std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-        //                                   << " with score " << result.second << "\n";
-        //
-        //                         std::cout << "Best line: ";
-        //                         for (int i = 0; i < depth; i++) {
-        //                             Move move = result.first[i];
-        //                             std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-        //                         }
-        //                         std::cout << "\n";
-        //                     } else {
-        //                         std::cout << "No moves available for White.\n";
-        //                     }
-        //                 }
-        //                 else if (chessBoard.ColorToMove() == Black) {
-        //                     tstart = omp_get_wtime();
-        //                     std::pair<std::array<Move, maxDepth>, int> result = engine.naiveParallelPVAlphaBeta<Black, maxDepth>(
-        //                         chessBoard,
-        //                         -50000,
-        //                         50000,
-        //                         depth
-        //                     );
-        //                     tend = omp_get_wtime();
-        //                     ttaken = tend - tstart;
-        //                     totalTime += ttaken;
-        //
-        //                     printf("Time taken for main part naive alpha beta parallel with PV combo: %f\n", ttaken);
-        //
-        //                     if (!result.first.empty()) {
-        //                         Move bestMove = result.first.front();
-        //                         std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-        //                                   << " with score " << result.second << "\n";
-        //
-        //                         std::cout << "Best line: ";
-        //                         for (int i = 0; i < depth; i++) {
-        //                             Move move = result.first[i];
-        //                             std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-        //                         }
-        //                         std::cout << "\n";
-        //                     } else {
-        //                         std::cout << "No moves available for White.\n";
-        //                     }
-        //                 }
-        //             }
-        //             averageTime = totalTime/20;
-        //             std::cout << "Average time for naive alpha beta parallel with YBWC combo in 20 iterations is: " << averageTime << " with " << threads << " threads" << "\n";
-        //             resultFile2 << "Naive Parallel Alpha Beta with PV," << threads << "," << averageTime << "\n";
-        //         }
-        //
-        //         for (int threads : numThreads) {
-        //             omp_set_num_threads(threads);
-        //             std::cout << "Algorithm: YBWC\n" << std::endl;
-        //
-        //             std::cout << "Total number of threads: " << threads << "\n" << std::endl;
-        //             totalTime = 0;
-        //             for (int i = 0; i < 20; i++) {
-        //                 if (chessBoard.ColorToMove() == White) {
-        //                     tstart = omp_get_wtime();
-        //                     std::pair<std::array<Move, maxDepth>, int> result = engine.YBWC<White, maxDepth>(
-        //                         chessBoard,
-        //                         -50000,
-        //                         50000,
-        //                         depth
-        //                     );
-        //                     tend = omp_get_wtime();
-        //                     ttaken = tend - tstart;
-        //                     totalTime += ttaken;
-        //
-        //                     printf("Time taken for main part YBWC: %f\n", ttaken);
-        //
-        //                     if (!result.first.empty()) {
-        //                         Move bestMove = result.first.front();
-        //                         std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-        //                                   << " with score " << result.second << "\n";
-        //
-        //                         std::cout << "Best line: ";
-        //                         for (int i = 0; i < depth; i++) {
-        //                             Move move = result.first[i];
-        //                             std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-        //                         }
-        //                         std::cout << "\n";
-        //                     } else {
-        //                         std::cout << "No moves available for White.\n";
-        //                     }
-        //                 }
-        //                 else if (chessBoard.ColorToMove() == Black) {
-        //                     tstart = omp_get_wtime();
-        //                     std::pair<std::array<Move, maxDepth>, int> result = engine.YBWC<Black, maxDepth>(
-        //                         chessBoard,
-        //                         -50000,
-        //                         50000,
-        //                         depth
-        //                     );
-        //                     tend = omp_get_wtime();
-        //                     ttaken = tend - tstart;
-        //                     totalTime += ttaken;
-        //
-        //                     printf("Time taken for main part YBWC: %f\n", ttaken);
-        //
-        //                     if (!result.first.empty()) {
-        //                         Move bestMove = result.first.front();
-        //                         std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-        //                                   << " with score " << result.second << "\n";
-        //
-        //                         std::cout << "Best line: ";
-        //                         for (int i = 0; i < depth; i++) {
-        //                             Move move = result.first[i];
-        //                             std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-        //                         }
-        //                         std::cout << "\n";
-        //                     } else {
-        //                         std::cout << "No moves available for White.\n";
-        //                     }
-        //                 }
-        //             }
-        //             averageTime = totalTime/20;
-        //             std::cout << "Average time for YBWC in 20 iterations is: " << averageTime << " with " << threads << " threads" << "\n";
-        //             resultFile2 << "YBWC," << threads << "," << averageTime << "\n";
-        //         }
-        //
-        //         for (int threads : numThreads) {
-        //             omp_set_num_threads(threads);
-        //             std::cout << "Algorithm: PVS\n" << std::endl;
-        //
-        //             std::cout << "Total number of threads: " << threads << "\n" << std::endl;
-        //             totalTime = 0;
-        //             for (int i = 0; i < 20; i++) {
-        //                 if (chessBoard.ColorToMove() == White) {
-        //                     tstart = omp_get_wtime();
-        //                     std::pair<std::array<Move, maxDepth>, int> result = engine.PVS<White, maxDepth>(
-        //                         chessBoard,
-        //                         -50000,
-        //                         50000,
-        //                         depth
-        //                     );
-        //                     tend = omp_get_wtime();
-        //                     ttaken = tend - tstart;
-        //                     totalTime += ttaken;
-        //
-        //                     printf("Time taken for main part PVS: %f\n", ttaken);
-        //
-        //                     if (!result.first.empty()) {
-        //                         Move bestMove = result.first.front();
-        //                         std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-        //                                   << " with score " << result.second << "\n";
-        //
-        //                         std::cout << "Best line: ";
-        //                         for (int i = 0; i < depth; i++) {
-        //                             Move move = result.first[i];
-        //                             std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-        //                         }
-        //                         std::cout << "\n";
-        //                     } else {
-        //                         std::cout << "No moves available for White.\n";
-        //                     }
-        //                 }
-        //                 else if (chessBoard.ColorToMove() == Black) {
-        //                     tstart = omp_get_wtime();
-        //                     std::pair<std::array<Move, maxDepth>, int> result = engine.PVS<Black, maxDepth>(
-        //                         chessBoard,
-        //                         -50000,
-        //                         50000,
-        //                         depth
-        //                     );
-        //                     tend = omp_get_wtime();
-        //                     ttaken = tend - tstart;
-        //                     totalTime += ttaken;
-        //
-        //                     printf("Time taken for main part PVS: %f\n", ttaken);
-        //
-        //                     if (!result.first.empty()) {
-        //                         Move bestMove = result.first.front();
-        //                         std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-        //                                   << " with score " << result.second << "\n";
-        //
-        //                         std::cout << "Best line: ";
-        //                         for (int i = 0; i < depth; i++) {
-        //                             Move move = result.first[i];
-        //                             std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-        //                         }
-        //                         std::cout << "\n";
-        //                     } else {
-        //                         std::cout << "No moves available for White.\n";
-        //                     }
-        //                 }
-        //             }
-        //             averageTime = totalTime/20;
-        //             std::cout << "Average time for PVS in 20 iterations is: " << averageTime << " with " << threads << " threads" << "\n";
-        //             resultFile2 << "PVS," << threads << "," << averageTime << "\n";
-        //         }
-        //     }
-        //
-        // }
-        //
-        // const char* mateIn1FENs[] = {
-        //     "3qk3/3pp1P1/8/8/8/8/8/4K3 w - - 0 1",
-        //     "3qk3/3pp1Q1/8/8/8/8/8/4K3 w - - 0 1",
-        //     "6rk/6pp/7N/8/8/8/8/4K3 w - - 0 1",
-        //     "7k/8/8/8/8/7r/r7/4K3 b - - 0 1",
-        //     "8/8/8/8/8/2n3k1/r4b2/5K2 b - - 0 1",
-        //     "2q5/8/8/8/8/6k1/r7/4K3 b - - 0 1",
-        //     "8/8/8/5q2/8/6k1/r7/4K3 b - - 0 1",
-        //     "8/8/8/8/8/6k1/r2PP3/4K3 b - - 0 1",
-        //     "8/8/8/8/8/nk6/3b4/K7 b - - 0 1"
-        // };
-        //
-        // std::ofstream resultFile1("results-m1.txt");
-        // if (!resultFile1.is_open()) {
-        //     std::cerr << "Error: Unable to open results.txt for writing\n";
-        //     return 0;
-        // }
-        // std::cout << "Testing mate in 1 FENs\n";
-        // for (const char* fen : mateIn1FENs) {
-        //     StockDory::Board chessBoard(fen);
-        //     resultFile1 << "Current Fen: " << fen << "\n";
-        //     std::cout << "Current Fen: " << fen << "\n" << std::endl;
-        //     for (int depth = 1; depth < 3; depth++) {
-        //         std::cout << "Testing depth: " << depth << "\n";
-        //         if (chessBoard.ColorToMove() == White) {
-        //             int result = engine.minimaxMoveCounter<White>(
-        //                 chessBoard,
-        //                 depth
-        //             );
-        //             printf("Total number of moves in minimax: %d\n", result);
-        //             resultFile1 << "Minimax moves: " << result << "\n";
-        //         }
-        //         if (chessBoard.ColorToMove() == White) {
-        //             int count = 0;
-        //             std::pair<std::array<Move, maxDepth>, int> result = engine.alphaBetaNegaMoveCounter<White, maxDepth>(
-        //                 chessBoard,
-        //                 -50000,
-        //                 50000,
-        //                 depth,
-        //                 count
-        //             );
-        //             printf("Total number of moves in alphaBeta: %d\n", count);
-        //             resultFile1 << "AlphaBeta moves: " << count << "\n";
-        //         }
-        //         if (chessBoard.ColorToMove() == Black) {
-        //             int result = engine.minimaxMoveCounter<Black>(
-        //                 chessBoard,
-        //                 depth
-        //             );
-        //             printf("Total number of moves in minimax: %d\n", result);
-        //             resultFile1 << "Minimax moves: " << result << "\n";
-        //         }
-        //         if (chessBoard.ColorToMove() == Black) {
-        //             int count = 0;
-        //             std::pair<std::array<Move, maxDepth>, int> result = engine.alphaBetaNegaMoveCounter<Black, maxDepth>(
-        //                 chessBoard,
-        //                 -50000,
-        //                 50000,
-        //                 depth,
-        //                 count
-        //             );
-        //             printf("Total number of moves in alphaBeta: %d\n", count);
-        //             resultFile1 << "AlphaBeta moves: " << count << "\n";
-        //         }
-        //         std::cout << "Algorithm: Sequential Minimax\n" << std::endl;
-        //         double totalTime = 0;
-        //         for (int i = 0; i < 20; i++) {
-        //             if (chessBoard.ColorToMove() == White) {
-        //                  tstart = omp_get_wtime();
-        //                  std::pair<std::array<Move, maxDepth>, int> result = engine.minimax<White, maxDepth>(
-        //                      chessBoard,
-        //                      depth
-        //                  );
-        //                  tend = omp_get_wtime();
-        //                  ttaken = tend - tstart;
-        //                  totalTime += ttaken;
-        //
-        //                  printf("Time taken for main part minimax: %f\n", ttaken);
-        //
-        //                  if (!result.first.empty()) {
-        //                      Move bestMove = result.first.front();
-        //                      std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-        //                                << " with score " << result.second << "\n";
-        //
-        //                      std::cout << "Best line: ";
-        //                      for (int i = 0; i < depth; i++) {
-        //                          Move move = result.first[i];
-        //                          std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-        //                      }
-        //                      std::cout << "\n";
-        //                  } else {
-        //                      std::cout << "No moves available for White.\n";
-        //                  }
-        //              }
-        //             else if (chessBoard.ColorToMove() == Black) {
-        //                 tstart = omp_get_wtime();
-        //                 std::pair<std::array<Move, maxDepth>, int> result = engine.minimax<Black, maxDepth>(
-        //                     chessBoard,
-        //                     depth
-        //                 );
-        //                 tend = omp_get_wtime();
-        //                 ttaken = tend - tstart;
-        //                 totalTime += ttaken;
-        //
-        //                 printf("Time taken for main part minimax: %f\n", ttaken);
-        //
-        //                 if (!result.first.empty()) {
-        //                     Move bestMove = result.first.front();
-        //                     std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-        //                               << " with score " << result.second << "\n";
-        //
-        //                     std::cout << "Best line: ";
-        //                     for (int i = 0; i < depth; i++) {
-        //                         Move move = result.first[i];
-        //                         std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-        //                     }
-        //                     std::cout << "\n";
-        //                 } else {
-        //                     std::cout << "No moves available for White.\n";
-        //                 }
-        //             }
-        //         }
-        //         double averageTime = totalTime/20;
-        //         std::cout << "Average time for minimax in 20 iterations is: " << averageTime << "\n";
-        //         resultFile1 << "Sequential Minimax,1," << averageTime << "\n";
-        //
-        //         int numThreads[] = {1, 2, 4, 8, 16, 32, 64};
-        //
-        //         for (int threads : numThreads) {
-        //             omp_set_num_threads(threads);
-        //             std::cout << "Algorithm: Parallel Minimax\n" << std::endl;
-        //             std::cout << "Total number of threads: " << threads << "\n" << std::endl;
-        //             totalTime = 0;
-        //             for (int i = 0; i < 20; i++) {
-        //                 if (chessBoard.ColorToMove() == White) {
-        //                     tstart = omp_get_wtime();
-        //                     std::pair<std::array<Move, maxDepth>, int> result = engine.parallelMinimax<White, maxDepth>(
-        //                         chessBoard,
-        //                         depth
-        //                     );
-        //                     tend = omp_get_wtime();
-        //                     ttaken = tend - tstart;
-        //                     totalTime += ttaken;
-        //
-        //                     printf("Time taken for main part parallel minimax: %f\n", ttaken);
-        //
-        //                     if (!result.first.empty()) {
-        //                         Move bestMove = result.first.front();
-        //                         std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-        //                                   << " with score " << result.second << "\n";
-        //
-        //                         std::cout << "Best line: ";
-        //                         for (int i = 0; i < depth; i++) {
-        //                             Move move = result.first[i];
-        //                             std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-        //                         }
-        //                         std::cout << "\n";
-        //                     } else {
-        //                         std::cout << "No moves available for White.\n";
-        //                     }
-        //                 }
-        //                 else if (chessBoard.ColorToMove() == Black) {
-        //                     tstart = omp_get_wtime();
-        //                     std::pair<std::array<Move, maxDepth>, int> result = engine.parallelMinimax<Black, maxDepth>(
-        //                         chessBoard,
-        //                         depth
-        //                     );
-        //                     tend = omp_get_wtime();
-        //                     ttaken = tend - tstart;
-        //                     totalTime += ttaken;
-        //
-        //                     printf("Time taken for main part parallel minimax: %f\n", ttaken);
-        //
-        //                     if (!result.first.empty()) {
-        //                         Move bestMove = result.first.front();
-        //                         std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-        //                                   << " with score " << result.second << "\n";
-        //
-        //                         std::cout << "Best line: ";
-        //                         for (int i = 0; i < depth; i++) {
-        //                             Move move = result.first[i];
-        //                             std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-        //                         }
-        //                         std::cout << "\n";
-        //                     } else {
-        //                         std::cout << "No moves available for White.\n";
-        //                     }
-        //                 }
-        //             }
-        //             averageTime = totalTime/20;
-        //             std::cout << "Average time for parallel minimax in 20 iterations is: " << averageTime << " with " << threads << " threads" << "\n";
-        //             resultFile1 << "Parallel Minimax," << threads << "," << averageTime << "\n";
-        //         }
-        //
-        //         std::cout << "Algorithm: Sequential AlphaBeta\n" << std::endl;
-        //         totalTime = 0;
-        //         for (int i = 0; i < 20; i++) {
-        //             if (chessBoard.ColorToMove() == White) {
-        //                 tstart = omp_get_wtime();
-        //                 std::pair<std::array<Move, maxDepth>, int> result = engine.alphaBetaNega<White, maxDepth>(
-        //                 chessBoard,
-        //                 -50000,
-        //                 50000,
-        //                     depth
-        //                 );
-        //                 tend = omp_get_wtime();
-        //                 ttaken = tend - tstart;
-        //                 totalTime += ttaken;
-        //
-        //                 printf("Time taken for main part sequential alpha beta: %f\n", ttaken);
-        //
-        //                 if (!result.first.empty()) {
-        //                     Move bestMove = result.first.front();
-        //                     std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-        //                               << " with score " << result.second << "\n";
-        //
-        //                     std::cout << "Best line: ";
-        //                     for (int i = 0; i < depth; i++) {
-        //                         Move move = result.first[i];
-        //                         std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-        //                     }
-        //                     std::cout << "\n";
-        //                 } else {
-        //                     std::cout << "No moves available for White.\n";
-        //                 }
-        //             }
-        //             else if (chessBoard.ColorToMove() == Black) {
-        //                 tstart = omp_get_wtime();
-        //                 std::pair<std::array<Move, maxDepth>, int> result = engine.alphaBetaNega<Black, maxDepth>(
-        //                 chessBoard,
-        //                 -50000,
-        //                 50000,
-        //                     depth
-        //                 );
-        //                 tend = omp_get_wtime();
-        //                 ttaken = tend - tstart;
-        //                 totalTime += ttaken;
-        //
-        //                 printf("Time taken for main part sequential alpha beta: %f\n", ttaken);
-        //
-        //                 if (!result.first.empty()) {
-        //                     Move bestMove = result.first.front();
-        //                     std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-        //                               << " with score " << result.second << "\n";
-        //
-        //                     std::cout << "Best line: ";
-        //                     for (int i = 0; i < depth; i++) {
-        //                         Move move = result.first[i];
-        //                         std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-        //                     }
-        //                     std::cout << "\n";
-        //                 } else {
-        //                     std::cout << "No moves available for White.\n";
-        //                 }
-        //             }
-        //         }
-        //         averageTime = totalTime/20;
-        //         std::cout << "Average time for sequential AlphaBeta in 20 iterations is: " << averageTime << "\n";
-        //         resultFile1 << "Sequential AlphaBeta,1," << averageTime << "\n";
-        //
-        //         for (int threads : numThreads) {
-        //             omp_set_num_threads(threads);
-        //             std::cout << "Algorithm: Naive Alpha Beta Parallel\n" << std::endl;
-        //
-        //             std::cout << "Total number of threads: " << threads << "\n" << std::endl;
-        //             totalTime = 0;
-        //             for (int i = 0; i < 20; i++) {
-        //                 if (chessBoard.ColorToMove() == White) {
-        //                     tstart = omp_get_wtime();
-        //                     std::pair<std::array<Move, maxDepth>, int> result = engine.naiveParallelAlphaBeta<White, maxDepth>(
-        //                         chessBoard,
-        //                         -50000,
-        //                         50000,
-        //                         depth
-        //                     );
-        //                     tend = omp_get_wtime();
-        //                     ttaken = tend - tstart;
-        //                     totalTime += ttaken;
-        //
-        //                     printf("Time taken for main part naive alpha beta parallel: %f\n", ttaken);
-        //
-        //                     if (!result.first.empty()) {
-        //                         Move bestMove = result.first.front();
-        //                         std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-        //                                   << " with score " << result.second << "\n";
-        //
-        //                         std::cout << "Best line: ";
-        //                         for (int i = 0; i < depth; i++) {
-        //                             Move move = result.first[i];
-        //                             std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-        //                         }
-        //                         std::cout << "\n";
-        //                     } else {
-        //                         std::cout << "No moves available for White.\n";
-        //                     }
-        //                 }
-        //                 else if (chessBoard.ColorToMove() == Black) {
-        //                     tstart = omp_get_wtime();
-        //                     std::pair<std::array<Move, maxDepth>, int> result = engine.naiveParallelAlphaBeta<Black, maxDepth>(
-        //                         chessBoard,
-        //                         -50000,
-        //                         50000,
-        //                         depth
-        //                     );
-        //                     tend = omp_get_wtime();
-        //                     ttaken = tend - tstart;
-        //                     totalTime += ttaken;
-        //
-        //                     printf("Time taken for main part naive alpha beta parallel: %f\n", ttaken);
-        //
-        //                     if (!result.first.empty()) {
-        //                         Move bestMove = result.first.front();
-        //                         std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-        //                                   << " with score " << result.second << "\n";
-        //
-        //                         std::cout << "Best line: ";
-        //                         for (int i = 0; i < depth; i++) {
-        //                             Move move = result.first[i];
-        //                             std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-        //                         }
-        //                         std::cout << "\n";
-        //                     } else {
-        //                         std::cout << "No moves available for White.\n";
-        //                     }
-        //                 }
-        //             }
-        //             averageTime = totalTime/20;
-        //             std::cout << "Average time for naive alpha beta parallel in 20 iterations is: " << averageTime << " with " << threads << " threads" << "\n";
-        //             resultFile1 << "Naive Parallel Alpha Beta," << threads << "," << averageTime << "\n";
-        //         }
-        //
-        //         for (int threads : numThreads) {
-        //             omp_set_num_threads(threads);
-        //             std::cout << "Algorithm: Naive Alpha Beta Parallel\n" << std::endl;
-        //
-        //             std::cout << "Total number of threads: " << threads << "\n" << std::endl;
-        //             totalTime = 0;
-        //             for (int i = 0; i < 20; i++) {
-        //                 if (chessBoard.ColorToMove() == White) {
-        //                     tstart = omp_get_wtime();
-        //                     std::pair<std::array<Move, maxDepth>, int> result = engine.naiveParallelPVAlphaBeta<White, maxDepth>(
-        //                         chessBoard,
-        //                         -50000,
-        //                         50000,
-        //                         depth
-        //                     );
-        //                     tend = omp_get_wtime();
-        //                     ttaken = tend - tstart;
-        //                     totalTime += ttaken;
-        //
-        //                     printf("Time taken for main part naive alpha beta parallel with PV combo: %f\n", ttaken);
-        //
-        //                     if (!result.first.empty()) {
-        //                         Move bestMove = result.first.front();
-        //                         std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-        //                                   << " with score " << result.second << "\n";
-        //
-        //                         std::cout << "Best line: ";
-        //                         for (int i = 0; i < depth; i++) {
-        //                             Move move = result.first[i];
-        //                             std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-        //                         }
-        //                         std::cout << "\n";
-        //                     } else {
-        //                         std::cout << "No moves available for White.\n";
-        //                     }
-        //                 }
-        //                 else if (chessBoard.ColorToMove() == Black) {
-        //                     tstart = omp_get_wtime();
-        //                     std::pair<std::array<Move, maxDepth>, int> result = engine.naiveParallelPVAlphaBeta<Black, maxDepth>(
-        //                         chessBoard,
-        //                         -50000,
-        //                         50000,
-        //                         depth
-        //                     );
-        //                     tend = omp_get_wtime();
-        //                     ttaken = tend - tstart;
-        //                     totalTime += ttaken;
-        //
-        //                     printf("Time taken for main part naive alpha beta parallel with PV combo: %f\n", ttaken);
-        //
-        //                     if (!result.first.empty()) {
-        //                         Move bestMove = result.first.front();
-        //                         std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-        //                                   << " with score " << result.second << "\n";
-        //
-        //                         std::cout << "Best line: ";
-        //                         for (int i = 0; i < depth; i++) {
-        //                             Move move = result.first[i];
-        //                             std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-        //                         }
-        //                         std::cout << "\n";
-        //                     } else {
-        //                         std::cout << "No moves available for White.\n";
-        //                     }
-        //                 }
-        //             }
-        //             averageTime = totalTime/20;
-        //             std::cout << "Average time for naive alpha beta parallel with YBWC combo in 20 iterations is: " << averageTime << " with " << threads << " threads" << "\n";
-        //             resultFile1 << "Naive Parallel Alpha Beta with PV," << threads << "," << averageTime << "\n";
-        //         }
-        //
-        //         for (int threads : numThreads) {
-        //             omp_set_num_threads(threads);
-        //             std::cout << "Algorithm: YBWC\n" << std::endl;
-        //
-        //             std::cout << "Total number of threads: " << threads << "\n" << std::endl;
-        //             totalTime = 0;
-        //             for (int i = 0; i < 20; i++) {
-        //                 if (chessBoard.ColorToMove() == White) {
-        //                     tstart = omp_get_wtime();
-        //                     std::pair<std::array<Move, maxDepth>, int> result = engine.YBWC<White, maxDepth>(
-        //                         chessBoard,
-        //                         -50000,
-        //                         50000,
-        //                         depth
-        //                     );
-        //                     tend = omp_get_wtime();
-        //                     ttaken = tend - tstart;
-        //                     totalTime += ttaken;
-        //
-        //                     printf("Time taken for main part YBWC: %f\n", ttaken);
-        //
-        //                     if (!result.first.empty()) {
-        //                         Move bestMove = result.first.front();
-        //                         std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-        //                                   << " with score " << result.second << "\n";
-        //
-        //                         std::cout << "Best line: ";
-        //                         for (int i = 0; i < depth; i++) {
-        //                             Move move = result.first[i];
-        //                             std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-        //                         }
-        //                         std::cout << "\n";
-        //                     } else {
-        //                         std::cout << "No moves available for White.\n";
-        //                     }
-        //                 }
-        //                 else if (chessBoard.ColorToMove() == Black) {
-        //                     tstart = omp_get_wtime();
-        //                     std::pair<std::array<Move, maxDepth>, int> result = engine.YBWC<Black, maxDepth>(
-        //                         chessBoard,
-        //                         -50000,
-        //                         50000,
-        //                         depth
-        //                     );
-        //                     tend = omp_get_wtime();
-        //                     ttaken = tend - tstart;
-        //                     totalTime += ttaken;
-        //
-        //                     printf("Time taken for main part YBWC: %f\n", ttaken);
-        //
-        //                     if (!result.first.empty()) {
-        //                         Move bestMove = result.first.front();
-        //                         std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-        //                                   << " with score " << result.second << "\n";
-        //
-        //                         std::cout << "Best line: ";
-        //                         for (int i = 0; i < depth; i++) {
-        //                             Move move = result.first[i];
-        //                             std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-        //                         }
-        //                         std::cout << "\n";
-        //                     } else {
-        //                         std::cout << "No moves available for White.\n";
-        //                     }
-        //                 }
-        //             }
-        //             averageTime = totalTime/20;
-        //             std::cout << "Average time for YBWC in 20 iterations is: " << averageTime << " with " << threads << " threads" << "\n";
-        //             resultFile1 << "YBWC," << threads << "," << averageTime << "\n";
-        //         }
-        //
-        //         for (int threads : numThreads) {
-        //             omp_set_num_threads(threads);
-        //             std::cout << "Algorithm: PVS\n" << std::endl;
-        //
-        //             std::cout << "Total number of threads: " << threads << "\n" << std::endl;
-        //             totalTime = 0;
-        //             for (int i = 0; i < 20; i++) {
-        //                 if (chessBoard.ColorToMove() == White) {
-        //                     tstart = omp_get_wtime();
-        //                     std::pair<std::array<Move, maxDepth>, int> result = engine.PVS<White, maxDepth>(
-        //                         chessBoard,
-        //                         -50000,
-        //                         50000,
-        //                         depth
-        //                     );
-        //                     tend = omp_get_wtime();
-        //                     ttaken = tend - tstart;
-        //                     totalTime += ttaken;
-        //
-        //                     printf("Time taken for main part PVS: %f\n", ttaken);
-        //
-        //                     if (!result.first.empty()) {
-        //                         Move bestMove = result.first.front();
-        //                         std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-        //                                   << " with score " << result.second << "\n";
-        //
-        //                         std::cout << "Best line: ";
-        //                         for (int i = 0; i < depth; i++) {
-        //                             Move move = result.first[i];
-        //                             std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-        //                         }
-        //                         std::cout << "\n";
-        //                     } else {
-        //                         std::cout << "No moves available for White.\n";
-        //                     }
-        //                 }
-        //                 else if (chessBoard.ColorToMove() == Black) {
-        //                     tstart = omp_get_wtime();
-        //                     std::pair<std::array<Move, maxDepth>, int> result = engine.PVS<Black, maxDepth>(
-        //                         chessBoard,
-        //                         -50000,
-        //                         50000,
-        //                         depth
-        //                     );
-        //                     tend = omp_get_wtime();
-        //                     ttaken = tend - tstart;
-        //                     totalTime += ttaken;
-        //
-        //                     printf("Time taken for main part PVS: %f\n", ttaken);
-        //
-        //                     if (!result.first.empty()) {
-        //                         Move bestMove = result.first.front();
-        //                         std::cout << "White Result is: " << squareToString(bestMove.From()) << " to " << squareToString(bestMove.To())
-        //                                   << " with score " << result.second << "\n";
-        //
-        //                         std::cout << "Best line: ";
-        //                         for (int i = 0; i < depth; i++) {
-        //                             Move move = result.first[i];
-        //                             std::cout << squareToString(move.From()) << " to " << squareToString(move.To()) << ", ";
-        //                         }
-        //                         std::cout << "\n";
-        //                     } else {
-        //                         std::cout << "No moves available for White.\n";
-        //                     }
-        //                 }
-        //             }
-        //             averageTime = totalTime/20;
-        //             std::cout << "Average time for PVS in 20 iterations is: " << averageTime << " with " << threads << " threads" << "\n";
-        //             resultFile1 << "PVS," << threads << "," << averageTime << "\n";
-        //         }
-        //     }
-        //
-        // }
-
     }
 
     return 0;
@@ -0,0 +1,259 @@
+// microbench.cpp
+// Times the hot primitives of the engine in isolation: move generation, make/unmake for every move type, the
+// evaluation, the sliding attack lookup and the transposition table. Every benchmark runs over the same corpus, all
+// positions two plies deep from the perft positions, so a change to one of them can be measured on its own.
+// Each benchmark is warmed up first and then timed over a number of passes over the corpus. The median and the fastest
+// pass are reported per operation, in nanoseconds and, on x86-64, in time stamp counter cycles.
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include "Backend/Board.h"
+#include "Backend/Type/Color.h"
+#include "Backend/TranspositionTable.h"
+#include "SimplifiedMoveList.h"
+#include "Evaluation.h"
+#include "HashEntry.h"
+
+#ifdef __x86_64__
+#include <x86intrin.h>
+#endif
+
+const int warmupPasses = 3;
+const int samplePasses = 15;
+const int corpusPlies = 2;
+
+// Same positions as perft.cpp
+const std::string corpusRoots[] = {
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+    "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+    "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+    "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10"
+};
+
+struct CorpusPosition {
+    StockDory::Board board;
+    std::vector<Move> moves;
+};
+
+// Keeps a result alive without storing it, so the compiler cannot drop the work that produced it
+template<typename T>
+inline void keep(const T &value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+inline uint64_t cycles() {
+#ifdef __x86_64__
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+template<Color color>
+std::vector<Move> legalMoves(const StockDory::Board &board) {
+    const StockDory::SimplifiedMoveList<color> moveList(board);
+    std::vector<Move> moves;
+    for (uint8_t i = 0; i < moveList.Count(); i++) {
+        moves.push_back(moveList[i]);
+    }
+    return moves;
+}
+
+void expand(std::vector<CorpusPosition> &corpus, const StockDory::Board &board, int plies) {
+    std::vector<Move> moves = board.ColorToMove() == White ? legalMoves<White>(board) : legalMoves<Black>(board);
+    if (plies > 0) {
+        for (const Move &move : moves) {
+            StockDory::Board child = board;
+            child.Move<0>(move.From(), move.To(), move.Promotion());
+            expand(corpus, child, plies - 1);
+        }
+    }
+    corpus.push_back({board, std::move(moves)});
+}
+
+struct Timing {
+    double nanoseconds;
+    double cycles;
+};
+
+// Runs the pass (which returns how many operations it did) until warm, then times every sample pass on its own
+template<typename Pass>
+void measure(const std::string &name, const std::string &filter, Pass pass) {
+    if (name.find(filter) == std::string::npos) {
+        return;
+    }
+
+    uint64_t operations = 0;
+    for (int i = 0; i < warmupPasses; i++) {
+        operations = pass();
+    }
+
+    std::vector<Timing> samples;
+    for (int i = 0; i < samplePasses; i++) {
+        auto start = std::chrono::steady_clock::now();
+        uint64_t startCycles = cycles();
+        pass();
+        uint64_t endCycles = cycles();
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        samples.push_back({seconds * 1e9 / operations, static_cast<double>(endCycles - startCycles) / operations});
+    }
+    std::sort(samples.begin(), samples.end(), [](const Timing &a, const Timing &b) {
+        return a.nanoseconds < b.nanoseconds;
+    });
+    const Timing &median = samples[samples.size() / 2];
+
+    std::cout << std::left << std::setw(34) << name << std::right << std::setw(10) << operations
+              << std::fixed << std::setprecision(2) << std::setw(12) << median.nanoseconds
+              << std::setw(12) << samples.front().nanoseconds;
+#ifdef __x86_64__
+    std::cout << std::setw(12) << median.cycles;
+#endif
+    std::cout << "\n";
+}
+
+template<MoveType T>
+void measureMakeUnmake(const std::string &name, const std::string &filter, std::vector<CorpusPosition> &corpus) {
+    measure(name, filter, [&corpus]() {
+        uint64_t operations = 0;
+        for (CorpusPosition &position : corpus) {
+            for (const Move &move : position.moves) {
+                PreviousState prevState = position.board.Move<T>(move.From(), move.To(), move.Promotion());
+                keep(position.board.Zobrist());
+                position.board.UndoMove<T>(prevState, move.From(), move.To());
+            }
+            operations += position.moves.size();
+        }
+        return operations;
+    });
+}
+
+int main(int argc, char* argv[]) {
+    // Optional argument: only run the benchmarks whose name contains it
+    std::string filter = argc > 1 ? argv[1] : "";
+
+    std::vector<CorpusPosition> corpus;
+    for (const std::string &fen : corpusRoots) {
+        expand(corpus, StockDory::Board(fen), corpusPlies);
+    }
+
+#ifdef STOCKDORY_PEXT
+    std::cout << "Sliding attacks: PEXT\n";
+#else
+    std::cout << "Sliding attacks: black magic\n";
+#endif
+    // Same cluster type and size as the ABDADA table
+    StockDory::TranspositionTable<StockDory::HashCluster> table(16 * 1024 * 1024);
+    const char* pages[] = {"heap", "4 KB pages", "transparent huge pages", "hugetlb pages"};
+    std::cout << "Hash table: " << pages[static_cast<int>(table.Backing())] << "\n";
+    std::cout << "Corpus: " << corpus.size() << " positions, " << warmupPasses << " warm-up and " << samplePasses
+              << " timed passes per benchmark\n\n";
+    std::cout << std::left << std::setw(34) << "benchmark" << std::right << std::setw(10) << "ops/pass"
+              << std::setw(12) << "median ns" << std::setw(12) << "min ns";
+#ifdef __x86_64__
+    std::cout << std::setw(12) << "cycles";
+#endif
+    std::cout << "\n";
+
+    measure("movegen SimplifiedMoveList", filter, [&corpus]() {
+        uint64_t moves = 0;
+        for (const CorpusPosition &position : corpus) {
+            if (position.board.ColorToMove() == White) {
+                const StockDory::SimplifiedMoveList<White> moveList(position.board);
+                moves += moveList.Count();
+            } else {
+                const StockDory::SimplifiedMoveList<Black> moveList(position.board);
+                moves += moveList.Count();
+            }
+        }
+        keep(moves);
+        return static_cast<uint64_t>(corpus.size());
+    });
+
+    // The searches and perft make their moves with no flags set
+    measureMakeUnmake<0       >("make/unmake (searches)", filter, corpus);
+    measureMakeUnmake<STANDARD>("make/unmake STANDARD", filter, corpus);
+    measureMakeUnmake<ZOBRIST >("make/unmake ZOBRIST", filter, corpus);
+    measureMakeUnmake<PERFT   >("make/unmake PERFT", filter, corpus);
+    measureMakeUnmake<NNUE    >("make/unmake NNUE", filter, corpus);
+
+    measure("eval", filter, [&corpus]() {
+        Evaluation evaluation;
+        for (const CorpusPosition &position : corpus) {
+            keep(evaluation.eval(position.board));
+        }
+        return static_cast<uint64_t>(corpus.size());
+    });
+
+    // A bishop and a rook on every square of every position's occupancy
+    measure("sliding SlidingIndex", filter, [&corpus]() {
+        for (const CorpusPosition &position : corpus) {
+            const BitBoard occupied = ~position.board[NAC];
+            for (uint8_t sq = 0; sq < 64; sq++) {
+                keep(StockDory::AttackTable::SlidingIndex(Bishop, static_cast<Square>(sq), occupied));
+                keep(StockDory::AttackTable::SlidingIndex(Rook  , static_cast<Square>(sq), occupied));
+            }
+        }
+        return static_cast<uint64_t>(corpus.size()) * 128;
+    });
+    measure("sliding attack lookup", filter, [&corpus]() {
+        for (const CorpusPosition &position : corpus) {
+            const BitBoard occupied = ~position.board[NAC];
+            for (uint8_t sq = 0; sq < 64; sq++) {
+                keep(StockDory::AttackTable::Sliding[
+                        StockDory::AttackTable::SlidingIndex(Bishop, static_cast<Square>(sq), occupied)]);
+                keep(StockDory::AttackTable::Sliding[
+                        StockDory::AttackTable::SlidingIndex(Rook  , static_cast<Square>(sq), occupied)]);
+            }
+        }
+        return static_cast<uint64_t>(corpus.size()) * 128;
+    });
+
+    // Every corpus position stored in the table
+    std::vector<ZobristHash> hashes;
+    for (const CorpusPosition &position : corpus) {
+        hashes.push_back(position.board.Zobrist());
+        if (!position.moves.empty()) {
+            table[position.board.Zobrist()].Store(position.board.Zobrist(), position.moves[0], 0, corpusPlies,
+                                                  StockDory::BoundExact, table.Generation());
+        }
+    }
+    measure("tt store", filter, [&table, &corpus]() {
+        for (const CorpusPosition &position : corpus) {
+            if (!position.moves.empty()) {
+                table[position.board.Zobrist()].Store(position.board.Zobrist(), position.moves[0], 0, corpusPlies,
+                                                      StockDory::BoundExact, table.Generation());
+            }
+        }
+        return static_cast<uint64_t>(corpus.size());
+    });
+    measure("tt probe", filter, [&table, &hashes]() {
+        StockDory::HashData hashData;
+        uint64_t hits = 0;
+        for (const ZobristHash hash : hashes) {
+            hits += table[hash].Probe(hash, hashData);
+        }
+        keep(hits);
+        return static_cast<uint64_t>(hashes.size());
+    });
+    // Prefetching a few positions ahead, the way a search would prefetch a child before making its move
+    measure("tt prefetch + probe", filter, [&table, &hashes]() {
+        StockDory::HashData hashData;
+        uint64_t hits = 0;
+        for (size_t i = 0; i < hashes.size(); i++) {
+            if (i + 8 < hashes.size()) {
+                table.Prefetch(hashes[i + 8]);
+            }
+            hits += table[hashes[i]].Probe(hashes[i], hashData);
+        }
+        keep(hits);
+        return static_cast<uint64_t>(hashes.size());
+    });
+
+    return 0;
+}
@@ -0,0 +1,80 @@
+// perft.cpp
+// Counts the leaf nodes of the legal move tree on a fixed set of positions and reports nodes per second.
+// The counts are checked against the published values, so the same binary confirms both move generation and the
+// sliding attack backend it was built with (black magic by default, PEXT with STOCKDORY_PEXT).
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <string>
+#include <cstdlib> // For std::atoi
+#include <cstdint>
+#include "Backend/Board.h"
+#include "Backend/Type/Color.h"
+#include "SimplifiedMoveList.h"
+
+struct PerftPosition {
+    std::string fen;
+    int depth;
+    uint64_t nodes;
+};
+
+// Positions and counts from the chessprogramming wiki "Perft Results" page
+const PerftPosition positions[] = {
+    {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", 6, 119060324},
+    {"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1", 5, 193690690},
+    {"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1", 6, 11030083},
+    {"r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1", 5, 15833292},
+    {"rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8", 5, 89941194},
+    {"r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10", 5, 164075551}
+};
+
+// Leaves at depth 1 are counted from the move list without making them
+template<Color color>
+uint64_t perft(StockDory::Board &board, int depth) {
+    const StockDory::SimplifiedMoveList<color> moveList(board);
+    if (depth == 1) {
+        return moveList.Count();
+    }
+    uint64_t nodes = 0;
+    for (uint8_t i = 0; i < moveList.Count(); i++) {
+        Move move = moveList[i];
+        PreviousState prevState = board.Move<0>(move.From(), move.To(), move.Promotion());
+        nodes += perft<Opposite(color)>(board, depth - 1);
+        board.UndoMove<0>(prevState, move.From(), move.To());
+    }
+    return nodes;
+}
+
+int main(int argc, char* argv[]) {
+    // Optional argument: plies to take off every position for a quick run
+    int reduction = argc > 1 ? std::atoi(argv[1]) : 0;
+
+#ifdef STOCKDORY_PEXT
+    std::cout << "Sliding attacks: PEXT (" << StockDory::AttackTable::SlidingSize << " entries)\n";
+#else
+    std::cout << "Sliding attacks: black magic (" << StockDory::AttackTable::SlidingSize << " entries)\n";
+#endif
+
+    bool allCorrect = true;
+    uint64_t totalNodes = 0;
+    double totalSeconds = 0;
+    for (const PerftPosition &position : positions) {
+        int depth = std::max(1, position.depth - reduction);
+        StockDory::Board board(position.fen);
+        auto start = std::chrono::steady_clock::now();
+        uint64_t nodes = board.ColorToMove() == White ? perft<White>(board, depth) : perft<Black>(board, depth);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        totalNodes += nodes;
+        totalSeconds += seconds;
+
+        bool correct = reduction != 0 || nodes == position.nodes;
+        allCorrect = allCorrect && correct;
+        std::cout << std::left << std::setw(80) << position.fen << " depth " << depth << ": " << nodes
+                  << " nodes, " << std::fixed << std::setprecision(3) << seconds << "s, "
+                  << static_cast<uint64_t>(nodes / seconds) << " nps" << (correct ? "" : " MISMATCH") << "\n";
+    }
+    std::cout << "Total: " << totalNodes << " nodes, " << std::fixed << std::setprecision(3) << totalSeconds << "s, "
+              << static_cast<uint64_t>(totalNodes / totalSeconds) << " nps\n";
+
+    return allCorrect ? 0 : 1;
+}